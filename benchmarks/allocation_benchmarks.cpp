@@ -0,0 +1,180 @@
+/* =====================================================================================
+ *
+ * Filename:  allocation_benchmarks.cpp
+ *
+ * Description:  Benchmarks for the std::pmr overloads: each one is run allocating
+ *               straight from the heap and from a monotonic arena which is released
+ *               in one go at the end of each iteration.  The 'allocations' and
+ *               'bytes_allocated' counters are per iteration and count what reached
+ *               the heap.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 20:41:18
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "synthetic_data.h"
+#include "trading_calendar.h"
+#include "utilities.h"
+
+namespace
+{
+// passes everything on to 'upstream', keeping count.
+
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    explicit CountingResource(std::pmr::memory_resource *upstream) : upstream_{upstream}
+    {
+    }
+
+    [[nodiscard]] size_t GetAllocationCount() const
+    {
+        return allocation_count_;
+    }
+    [[nodiscard]] size_t GetBytesAllocated() const
+    {
+        return bytes_allocated_;
+    }
+
+private:
+    void *do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++allocation_count_;
+        bytes_allocated_ += bytes;
+        return upstream_->allocate(bytes, alignment);
+    }
+    void do_deallocate(void *p, size_t bytes, size_t alignment) override
+    {
+        upstream_->deallocate(p, bytes, alignment);
+    }
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource *upstream_;
+    size_t allocation_count_ = 0;
+    size_t bytes_allocated_ = 0;
+};
+
+// run 'func(resource)' once per iteration. With the arena, everything 'func' allocates
+// is given back when the arena goes out of scope, as a batch job would at the end of
+// each symbol.
+
+template <typename Func> void RunWithResource(benchmark::State &state, bool use_arena, Func &&func)
+{
+    CountingResource heap{std::pmr::new_delete_resource()};
+    for (auto _ : state)
+    {
+        if (use_arena)
+        {
+            std::pmr::monotonic_buffer_resource arena{&heap};
+            func(&arena);
+        }
+        else
+        {
+            func(&heap);
+        }
+    }
+    state.counters["allocations"] =
+        benchmark::Counter(static_cast<double>(heap.GetAllocationCount()), benchmark::Counter::kAvgIterations);
+    state.counters["bytes_allocated"] =
+        benchmark::Counter(static_cast<double>(heap.GetBytesAllocated()), benchmark::Counter::kAvgIterations);
+}
+
+// split CSV text into lines. The lines are too long for the short string optimization so
+// each one is an allocation.  range(0) is the number of lines.
+
+void BM_PMR_split_string(benchmark::State &state, bool use_arena)
+{
+    const auto text = synthetic_data::MakeCSVPriceRows(static_cast<size_t>(state.range(0)));
+    RunWithResource(state, use_arena, [&text](std::pmr::memory_resource *resource) {
+        auto lines = split_string<std::pmr::string>(text, "\n", resource);
+        benchmark::DoNotOptimize(lines.data());
+    });
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+// range(0) is the number of rows.
+
+void BM_PMR_ConvertJSONPriceHistory(benchmark::State &state, bool use_arena)
+{
+    const auto how_many = static_cast<uint32_t>(state.range(0));
+    const auto the_data = ParseJSONData(synthetic_data::MakeTiingoPriceHistoryJSON(how_many));
+    RunWithResource(state, use_arena, [&](std::pmr::memory_resource *resource) {
+        auto history = ConvertJSONPriceHistoryPMR("SYM", the_data, how_many, UseAdjusted::e_Yes, resource);
+        benchmark::DoNotOptimize(history.data());
+    });
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PMR_MakeHolidayList(benchmark::State &state, bool use_arena)
+{
+    int32_t which_year = 1950;
+    RunWithResource(state, use_arena, [&which_year](std::pmr::memory_resource *resource) {
+        auto holidays = MakeHolidayList(std::chrono::year{which_year}, resource);
+        benchmark::DoNotOptimize(holidays.data());
+        which_year = which_year == 2100 ? 1950 : which_year + 1;
+    });
+    state.SetItemsProcessed(state.iterations());
+}
+
+// range(0) is the number of business days in the list.
+
+void BM_PMR_ConstructeBusinessDayList(benchmark::State &state, bool use_arena)
+{
+    const std::chrono::year_month_day start_from{std::chrono::year{2005} / 1 / 3};
+    const auto &calendar = GetUS_TradingCalendar();
+    RunWithResource(state, use_arena, [&](std::pmr::memory_resource *resource) {
+        auto days = ConstructeBusinessDayList(start_from, static_cast<size_t>(state.range(0)), UpOrDown::e_Up,
+                                              calendar, resource);
+        benchmark::DoNotOptimize(days.data());
+    });
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// what a per symbol batch job does: convert the history, list its business days and
+// the holidays of its last year.  range(0) is the number of rows.
+
+void BM_PMR_PerSymbolPipeline(benchmark::State &state, bool use_arena)
+{
+    const auto how_many = static_cast<uint32_t>(state.range(0));
+    const auto the_data = ParseJSONData(synthetic_data::MakeTiingoPriceHistoryJSON(how_many));
+    const std::chrono::year_month_day start_from{std::chrono::year{2005} / 1 / 3};
+    const auto &calendar = GetUS_TradingCalendar();
+    RunWithResource(state, use_arena, [&](std::pmr::memory_resource *resource) {
+        auto history = ConvertJSONPriceHistoryPMR("SYM", the_data, how_many, UseAdjusted::e_Yes, resource);
+        auto days = ConstructeBusinessDayList(start_from, how_many, UpOrDown::e_Up, calendar, resource);
+        auto holidays = MakeHolidayList(days.back().year(), resource);
+        benchmark::DoNotOptimize(history.data());
+        benchmark::DoNotOptimize(holidays.data());
+    });
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK_CAPTURE(BM_PMR_split_string, heap, false)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK_CAPTURE(BM_PMR_split_string, arena, true)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK_CAPTURE(BM_PMR_ConvertJSONPriceHistory, heap, false)->Arg(250)->Arg(5'000);
+BENCHMARK_CAPTURE(BM_PMR_ConvertJSONPriceHistory, arena, true)->Arg(250)->Arg(5'000);
+BENCHMARK_CAPTURE(BM_PMR_MakeHolidayList, heap, false);
+BENCHMARK_CAPTURE(BM_PMR_MakeHolidayList, arena, true);
+BENCHMARK_CAPTURE(BM_PMR_ConstructeBusinessDayList, heap, false)->Arg(250)->Arg(5'000);
+BENCHMARK_CAPTURE(BM_PMR_ConstructeBusinessDayList, arena, true)->Arg(250)->Arg(5'000);
+BENCHMARK_CAPTURE(BM_PMR_PerSymbolPipeline, heap, false)->Arg(250)->Arg(5'000);
+BENCHMARK_CAPTURE(BM_PMR_PerSymbolPipeline, arena, true)->Arg(250)->Arg(5'000);
@@ -0,0 +1,208 @@
+/* =====================================================================================
+ *
+ * Filename:  date_time_benchmarks.cpp
+ *
+ * Description:  Benchmarks for the date parsing, holiday, business day and market
+ *               hours code.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 11:15:02
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <chrono>
+#include <format>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "market_session_clock.h"
+#include "synthetic_data.h"
+#include "trading_calendar.h"
+#include "us_holidays.h"
+#include "utilities.h"
+
+namespace
+{
+constexpr size_t how_many_samples = 4096;
+
+void BM_StringToDateYMD_ISO(benchmark::State &state)
+{
+    const auto dates = synthetic_data::MakeDateStrings(how_many_samples);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(StringToDateYMD("%Y-%m-%d", dates[i++ % dates.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// not ISO so it goes through the stream based parser.
+
+void BM_StringToDateYMD_Other(benchmark::State &state)
+{
+    std::vector<std::string> dates;
+    for (const auto &day : synthetic_data::MakeRandomDays(how_many_samples, std::chrono::year{1990},
+                                                          std::chrono::year{2030}))
+    {
+        dates.push_back(std::format("{:%m/%d/%Y}", day));
+    }
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(StringToDateYMD("%m/%d/%Y", dates[i++ % dates.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_StringToUTCTimePoint(benchmark::State &state)
+{
+    const auto time_stamps = synthetic_data::MakeTimeStampStrings(how_many_samples);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(StringToUTCTimePoint("%Y-%m-%dT%H:%M:%S", time_stamps[i++ % time_stamps.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_MakeHolidayList(benchmark::State &state)
+{
+    int32_t which_year = 1950;
+    for (auto _ : state)
+    {
+        auto holidays = MakeHolidayList(std::chrono::year{which_year});
+        benchmark::DoNotOptimize(holidays.data());
+        which_year = which_year == 2100 ? 1950 : which_year + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_IsUS_MarketOpen(benchmark::State &state)
+{
+    const auto days =
+        synthetic_data::MakeRandomDays(how_many_samples, std::chrono::year{1990}, std::chrono::year{2030});
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(IsUS_MarketOpen(days[i++ % days.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_TradingCalendarAddBusinessDays(benchmark::State &state)
+{
+    const auto &calendar = GetUS_TradingCalendar();
+    const auto days =
+        synthetic_data::MakeRandomDays(how_many_samples, std::chrono::year{1990}, std::chrono::year{2030});
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(calendar.AddBusinessDays(days[i++ % days.size()], 250));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_TradingCalendarBusinessDaysBetween(benchmark::State &state)
+{
+    const auto &calendar = GetUS_TradingCalendar();
+    const auto days =
+        synthetic_data::MakeRandomDays(how_many_samples, std::chrono::year{1990}, std::chrono::year{2030});
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(calendar.BusinessDaysBetween(days[i % days.size()], days[(i + 1) % days.size()]));
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// range(0) is the number of business days in the list.
+
+void BM_ConstructeBusinessDayList_Holidays(benchmark::State &state)
+{
+    const std::chrono::year_month_day start_from{std::chrono::year{2005} / 1 / 3};
+    US_MarketHolidays holidays;
+    for (int32_t y = 2005; y <= 2030; ++y)
+    {
+        const auto some_holidays = MakeHolidayList(std::chrono::year{y});
+        holidays.insert(holidays.end(), some_holidays.begin(), some_holidays.end());
+    }
+    for (auto _ : state)
+    {
+        auto days = ConstructeBusinessDayList(start_from, static_cast<size_t>(state.range(0)), UpOrDown::e_Up,
+                                              &holidays);
+        benchmark::DoNotOptimize(days.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ConstructeBusinessDayList_Calendar(benchmark::State &state)
+{
+    const std::chrono::year_month_day start_from{std::chrono::year{2005} / 1 / 3};
+    for (auto _ : state)
+    {
+        auto days = ConstructeBusinessDayList(start_from, static_cast<size_t>(state.range(0)), UpOrDown::e_Up,
+                                              GetUS_TradingCalendar());
+        benchmark::DoNotOptimize(days.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// a streaming client checks the status on every tick so consecutive times are close.
+
+std::vector<std::chrono::local_seconds> MakeTickTimes()
+{
+    std::vector<std::chrono::local_seconds> result;
+    result.reserve(how_many_samples);
+    auto when = std::chrono::local_days{std::chrono::year{2025} / 3 / 3} + std::chrono::hours{6};
+    for (size_t i = 0; i < how_many_samples; ++i)
+    {
+        result.push_back(when);
+        when += std::chrono::seconds{7};
+    }
+    return result;
+}
+
+void BM_GetUS_MarketStatus(benchmark::State &state)
+{
+    const auto tick_times = MakeTickTimes();
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(GetUS_MarketStatus("America/Chicago", tick_times[i++ % tick_times.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_MarketSessionClock(benchmark::State &state)
+{
+    const auto tick_times = MakeTickTimes();
+    MarketSessionClock clock{"America/Chicago"};
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(clock.GetStatus(tick_times[i++ % tick_times.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(BM_StringToDateYMD_ISO);
+BENCHMARK(BM_StringToDateYMD_Other);
+BENCHMARK(BM_StringToUTCTimePoint);
+BENCHMARK(BM_MakeHolidayList);
+BENCHMARK(BM_IsUS_MarketOpen);
+BENCHMARK(BM_TradingCalendarAddBusinessDays);
+BENCHMARK(BM_TradingCalendarBusinessDaysBetween);
+BENCHMARK(BM_ConstructeBusinessDayList_Holidays)->Arg(20)->Arg(250)->Arg(5'000);
+BENCHMARK(BM_ConstructeBusinessDayList_Calendar)->Arg(20)->Arg(250)->Arg(5'000);
+BENCHMARK(BM_GetUS_MarketStatus);
+BENCHMARK(BM_MarketSessionClock);
@@ -0,0 +1,239 @@
+/* =====================================================================================
+ *
+ * Filename:  decimal_benchmarks.cpp
+ *
+ * Description:  Benchmarks for price arithmetic: Decimal vs FixedPrice and rescale_dpr,
+ *               and for parsing prices into Decimal.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 11:42:26
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "decimal_from_chars.h"
+#include "fixed_price.h"
+#include "synthetic_data.h"
+#include "utilities.h"
+
+namespace
+{
+constexpr size_t how_many_prices = 4096;
+
+using Price = FixedPrice<4>;
+
+std::vector<Price> MakeFixedPrices()
+{
+    std::vector<Price> result;
+    for (const auto &price : synthetic_data::MakePrices(how_many_prices, 4))
+    {
+        result.emplace_back(price);
+    }
+    return result;
+}
+
+// the inner loop of a P&F column update: move by boxes and compare against the reversal.
+
+void BM_BoxArithmetic_Decimal(benchmark::State &state)
+{
+    const auto prices = synthetic_data::MakePrices(how_many_prices, 4);
+    const Decimal box_size{"0.5"};
+    for (auto _ : state)
+    {
+        Decimal top = prices.front();
+        int32_t boxes = 0;
+        for (const auto &price : prices)
+        {
+            while (price >= top + box_size)
+            {
+                top += box_size;
+                ++boxes;
+            }
+            if (price < top - 3 * box_size)
+            {
+                top = price;
+            }
+        }
+        benchmark::DoNotOptimize(boxes);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(prices.size()));
+}
+
+void BM_BoxArithmetic_FixedPrice(benchmark::State &state)
+{
+    const auto prices = MakeFixedPrices();
+    const auto box_size = *Price::FromString("0.5");
+    for (auto _ : state)
+    {
+        Price top = prices.front();
+        int32_t boxes = 0;
+        for (const auto &price : prices)
+        {
+            while (price >= top + box_size)
+            {
+                top += box_size;
+                ++boxes;
+            }
+            if (price < top - 3 * box_size)
+            {
+                top = price;
+            }
+        }
+        benchmark::DoNotOptimize(boxes);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(prices.size()));
+}
+
+void BM_Sum_Decimal(benchmark::State &state)
+{
+    const auto prices = synthetic_data::MakePrices(how_many_prices, 4);
+    for (auto _ : state)
+    {
+        Decimal total{0};
+        for (const auto &price : prices)
+        {
+            total += price;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(prices.size()));
+}
+
+void BM_Sum_FixedPrice(benchmark::State &state)
+{
+    const auto prices = MakeFixedPrices();
+    for (auto _ : state)
+    {
+        Price total;
+        for (const auto &price : prices)
+        {
+            total += price;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(prices.size()));
+}
+
+void BM_Parse_Decimal(benchmark::State &state)
+{
+    const auto prices = synthetic_data::MakePriceStrings(how_many_prices, 4);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Decimal{prices[i++ % prices.size()].c_str()});
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// DecimalFromChars is checked against the general parser in tests/decimal_from_chars_tests.cpp.
+
+void BM_Parse_DecimalFromChars(benchmark::State &state)
+{
+    const auto prices = synthetic_data::MakePriceStrings(how_many_prices, 4);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        Decimal value;
+        benchmark::DoNotOptimize(DecimalFromChars(prices[i++ % prices.size()], value));
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Parse_DecimalFromChars_Batch(benchmark::State &state)
+{
+    const auto prices = synthetic_data::MakePriceStrings(how_many_prices, 4);
+    const std::vector<std::string_view> fields(prices.begin(), prices.end());
+    std::vector<Decimal> values(fields.size());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(DecimalFromChars(fields, values));
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(fields.size()));
+}
+
+void BM_Parse_FixedPrice(benchmark::State &state)
+{
+    const auto prices = synthetic_data::MakePriceStrings(how_many_prices, 4);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Price::FromString(prices[i++ % prices.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_FixedPriceDecimalRoundTrip(benchmark::State &state)
+{
+    const auto prices = synthetic_data::MakePrices(how_many_prices, 4);
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Price{prices[i++ % prices.size()]}.ToDecimal());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T> std::vector<T> MakeDecimals()
+{
+    std::vector<T> result;
+    for (const auto &price : synthetic_data::MakePriceStrings(how_many_prices, 6))
+    {
+        result.emplace_back(price.c_str());
+    }
+    return result;
+}
+
+template <typename T> void BM_rescale_dpr(benchmark::State &state)
+{
+    const auto prices = MakeDecimals<T>();
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rescale_dpr(prices[i++ % prices.size()], 2));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T> void BM_rescale_dpr_Batch(benchmark::State &state)
+{
+    const auto prices = MakeDecimals<T>();
+    std::vector<T> work;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        work = prices;
+        state.ResumeTiming();
+        rescale_dpr(std::span<T>{work}, 2);
+        benchmark::DoNotOptimize(work.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(prices.size()));
+}
+} // namespace
+
+BENCHMARK(BM_BoxArithmetic_Decimal);
+BENCHMARK(BM_BoxArithmetic_FixedPrice);
+BENCHMARK(BM_Sum_Decimal);
+BENCHMARK(BM_Sum_FixedPrice);
+BENCHMARK(BM_Parse_Decimal);
+BENCHMARK(BM_Parse_DecimalFromChars);
+BENCHMARK(BM_Parse_DecimalFromChars_Batch);
+BENCHMARK(BM_Parse_FixedPrice);
+BENCHMARK(BM_FixedPriceDecimalRoundTrip);
+BENCHMARK(BM_rescale_dpr<bd::decimal64_t>);
+BENCHMARK(BM_rescale_dpr<bd::decimal128_t>);
+BENCHMARK(BM_rescale_dpr_Batch<bd::decimal64_t>);
+BENCHMARK(BM_rescale_dpr_Batch<bd::decimal128_t>);
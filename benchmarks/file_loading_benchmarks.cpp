@@ -0,0 +1,178 @@
+/* =====================================================================================
+ *
+ * Filename:  file_loading_benchmarks.cpp
+ *
+ * Description:  Benchmarks for reading, mapping and parsing data files.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 10:26:51
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <format>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "mapped_file.h"
+#include "parallel_file_loader.h"
+#include "price_history_columns.h"
+#include "price_snapshot.h"
+#include "synthetic_data.h"
+#include "utilities.h"
+
+namespace
+{
+// range(0) is the number of price rows in the file. ~330 bytes each.
+
+void BM_LoadDataFileForUse(benchmark::State &state)
+{
+    const synthetic_data::TemporaryDirectory directory;
+    const auto file_name = directory.WriteFile(
+        "history.json", synthetic_data::MakeTiingoPriceHistoryJSON(static_cast<size_t>(state.range(0))));
+    const auto file_size = static_cast<int64_t>(fs::file_size(file_name));
+
+    for (auto _ : state)
+    {
+        auto contents = LoadDataFileForUse(file_name);
+        benchmark::DoNotOptimize(contents.data());
+    }
+    state.SetBytesProcessed(state.iterations() * file_size);
+}
+
+void BM_MappedFile(benchmark::State &state)
+{
+    const synthetic_data::TemporaryDirectory directory;
+    const auto file_name = directory.WriteFile(
+        "history.json", synthetic_data::MakeTiingoPriceHistoryJSON(static_cast<size_t>(state.range(0))));
+    const auto file_size = static_cast<int64_t>(fs::file_size(file_name));
+
+    for (auto _ : state)
+    {
+        // touch every page so this compares fairly with reading the file.
+
+        const MappedFile mapped_file{file_name};
+        size_t total = 0;
+        for (size_t i = 0; i < mapped_file.size(); i += 4096)
+        {
+            total += static_cast<unsigned char>(mapped_file.data()[i]);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * file_size);
+}
+
+void BM_ReadAndParsePF_ChartJSONFile(benchmark::State &state)
+{
+    const synthetic_data::TemporaryDirectory directory;
+    const auto file_name = directory.WriteFile(
+        "history.json", synthetic_data::MakeTiingoPriceHistoryJSON(static_cast<size_t>(state.range(0))));
+    const auto file_size = static_cast<int64_t>(fs::file_size(file_name));
+
+    for (auto _ : state)
+    {
+        auto data = ReadAndParsePF_ChartJSONFile(file_name);
+        benchmark::DoNotOptimize(data);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * file_size);
+}
+
+// startup load of many per-symbol chart files. range(0) is the file count,
+// range(1) the thread count. 1 thread is the serial baseline.
+
+void BM_LoadJSONFilesInParallel(benchmark::State &state)
+{
+    const synthetic_data::TemporaryDirectory directory;
+    const auto how_many_files = static_cast<size_t>(state.range(0));
+    std::vector<fs::path> file_names;
+    file_names.reserve(how_many_files);
+    for (size_t i = 0; i < how_many_files; ++i)
+    {
+        file_names.push_back(directory.WriteFile(
+            std::format("SYM{}.json", i),
+            synthetic_data::MakeTiingoPriceHistoryJSON(250, synthetic_data::DefaultSeed + static_cast<uint32_t>(i))));
+    }
+
+    const ParallelLoadOptions options{.thread_count_ = static_cast<uint32_t>(state.range(1))};
+    for (auto _ : state)
+    {
+        size_t total = 0;
+        LoadJSONFilesInParallel(
+            file_names, [&total](LoadedJSONFile &&loaded) { total += loaded.data_.size(); }, options);
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// reload a price history: parse the JSON file vs map a binary snapshot.
+
+void BM_ReloadHistoryFromJSON(benchmark::State &state)
+{
+    const synthetic_data::TemporaryDirectory directory;
+    const auto file_name = directory.WriteFile(
+        "history.json", synthetic_data::MakeTiingoPriceHistoryJSON(static_cast<size_t>(state.range(0))));
+
+    for (auto _ : state)
+    {
+        const MappedFile mapped_file{file_name};
+        auto history = ParseJSONPriceHistoryToColumns("SYM", mapped_file.AsStringView(),
+                                                      static_cast<uint32_t>(state.range(0)), UseAdjusted::e_No);
+        benchmark::DoNotOptimize(history.GetCloses().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ReloadHistoryFromSnapshot(benchmark::State &state)
+{
+    const synthetic_data::TemporaryDirectory directory;
+    const auto json = synthetic_data::MakeTiingoPriceHistoryJSON(static_cast<size_t>(state.range(0)));
+    const auto file_name = directory.GetPath() / "history.snapshot";
+    WritePriceSnapshot(file_name, ParseJSONPriceHistoryToColumns("SYM", json, static_cast<uint32_t>(state.range(0)),
+                                                                 UseAdjusted::e_No));
+
+    for (auto _ : state)
+    {
+        const PriceSnapshotReader snapshot{file_name};
+        Decimal total{0};
+        for (const auto &close : snapshot.GetCloses())
+        {
+            total += close;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_WritePriceSnapshot(benchmark::State &state)
+{
+    const synthetic_data::TemporaryDirectory directory;
+    const auto records = synthetic_data::MakeMultiSymbolDateCloseRecords(100, static_cast<size_t>(state.range(0)));
+    const auto file_name = directory.GetPath() / "closes.snapshot";
+
+    for (auto _ : state)
+    {
+        WritePriceSnapshot(file_name, records);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(records.size()));
+}
+} // namespace
+
+BENCHMARK(BM_LoadDataFileForUse)->Arg(250)->Arg(5'000)->Arg(50'000);
+BENCHMARK(BM_MappedFile)->Arg(250)->Arg(5'000)->Arg(50'000);
+BENCHMARK(BM_ReadAndParsePF_ChartJSONFile)->Arg(250)->Arg(5'000)->Arg(50'000);
+BENCHMARK(BM_LoadJSONFilesInParallel)
+    ->ArgsProduct({{500}, {1, 2, 4, 8}})
+    ->ArgNames({"files", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_ReloadHistoryFromJSON)->Arg(5'000)->Arg(50'000);
+BENCHMARK(BM_ReloadHistoryFromSnapshot)->Arg(5'000)->Arg(50'000);
+BENCHMARK(BM_WritePriceSnapshot)->Arg(250)->Arg(2'500);
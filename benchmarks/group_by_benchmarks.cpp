@@ -0,0 +1,86 @@
+/* =====================================================================================
+ *
+ * Filename:  group_by_benchmarks.cpp
+ *
+ * Description:  Benchmarks for regrouping multi symbol date/close data by symbol:
+ *               std::sort on the symbol string vs the radix sort grouper, in
+ *               memory and spilling to disk.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 18:57:06
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "date_close_grouper.h"
+#include "synthetic_data.h"
+
+namespace
+{
+// 500 symbols. range(0) is the number of days so rows = 500 * range(0).
+
+constexpr size_t how_many_symbols = 500;
+
+void BM_GroupBySymbol_StdSort(benchmark::State &state)
+{
+    const auto records =
+        synthetic_data::MakeMultiSymbolDateCloseRecords(how_many_symbols, static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        auto sorted = records;
+        std::ranges::sort(sorted, [](const auto &lhs, const auto &rhs) {
+            return std::tie(lhs.symbol_, lhs.date_) < std::tie(rhs.symbol_, rhs.date_);
+        });
+        benchmark::DoNotOptimize(sorted.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(records.size()));
+}
+
+void BM_GroupBySymbol_Radix(benchmark::State &state)
+{
+    const auto records =
+        synthetic_data::MakeMultiSymbolDateCloseRecords(how_many_symbols, static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        auto grouped = GroupBySymbol(records);
+        benchmark::DoNotOptimize(grouped.GetCloses(0).data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(records.size()));
+}
+
+// a budget of 1/8 of what the rows need (24 bytes each, twice over while sorting)
+// so we write and merge about 8 runs.
+
+void BM_GroupBySymbol_External(benchmark::State &state)
+{
+    const auto records =
+        synthetic_data::MakeMultiSymbolDateCloseRecords(how_many_symbols, static_cast<size_t>(state.range(0)));
+    const synthetic_data::TemporaryDirectory temporary_directory;
+    const DateCloseGrouperOptions options{.memory_budget_bytes_ = records.size() * 2 * 24 / 8,
+                                          .temporary_directory_ = temporary_directory.GetPath()};
+    for (auto _ : state)
+    {
+        DateCloseGrouper grouper{options};
+        grouper.Add(records);
+        size_t how_many = 0;
+        grouper.Finish([&how_many](auto, auto dates, auto) { how_many += dates.size(); });
+        benchmark::DoNotOptimize(how_many);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(records.size()));
+}
+} // namespace
+
+BENCHMARK(BM_GroupBySymbol_StdSort)->Arg(250)->Arg(2'500)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GroupBySymbol_Radix)->Arg(250)->Arg(2'500)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GroupBySymbol_External)->Arg(250)->Arg(2'500)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,227 @@
+/* =====================================================================================
+ *
+ * Filename:  price_history_benchmarks.cpp
+ *
+ * Description:  Benchmarks for turning Tiingo JSON price histories into records,
+ *               and the peak memory of parsing to a DOM first vs streaming.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 10:54:37
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <cstdint>
+#include <exception>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include "price_history_columns.h"
+#include "synthetic_data.h"
+#include "utilities.h"
+
+namespace
+{
+// how much the peak resident set grows while 'func' runs, in KB, or -1 if we couldn't
+// tell.  'func' runs in a forked child so each path starts from the same memory and
+// nothing one leaves behind (such as memory the allocator keeps) counts against the
+// other.  The child's peak starts out at the parent's resident set so we report the
+// increase.
+
+template <typename Func> int64_t PeakRSSIncrease(Func &&func)
+{
+    int result_pipe[2];
+    if (pipe(result_pipe) != 0)
+    {
+        return -1;
+    }
+    const pid_t child = fork();
+    if (child == -1)
+    {
+        close(result_pipe[0]);
+        close(result_pipe[1]);
+        return -1;
+    }
+    if (child == 0)
+    {
+        close(result_pipe[0]);
+        int64_t increase = -1;
+        try
+        {
+            rusage usage{};
+            getrusage(RUSAGE_SELF, &usage);
+            const auto before = usage.ru_maxrss;
+            func();
+            getrusage(RUSAGE_SELF, &usage);
+            increase = usage.ru_maxrss - before;
+        }
+        catch (const std::exception &)
+        {
+        }
+        const bool sent = write(result_pipe[1], &increase, sizeof(increase)) == sizeof(increase);
+        _exit(sent ? 0 : 1);
+    }
+
+    close(result_pipe[1]);
+    int64_t increase = -1;
+    if (read(result_pipe[0], &increase, sizeof(increase)) != sizeof(increase))
+    {
+        increase = -1;
+    }
+    close(result_pipe[0]);
+    int status = 0;
+    waitpid(child, &status, 0);
+    return increase;
+}
+
+// range(0) is the number of rows. ~5000 is 20 years of daily prices.
+
+void BM_ConvertJSONPriceHistory(benchmark::State &state)
+{
+    const auto how_many = static_cast<uint32_t>(state.range(0));
+    const auto the_data = ParseJSONData(synthetic_data::MakeTiingoPriceHistoryJSON(how_many));
+
+    for (auto _ : state)
+    {
+        auto history = ConvertJSONPriceHistory("SYM", the_data, how_many, UseAdjusted::e_Yes);
+        benchmark::DoNotOptimize(history.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// range(1) is the thread count so we can see how it scales with cores.
+
+void BM_ConvertJSONPriceHistoryThreads(benchmark::State &state)
+{
+    const auto how_many = static_cast<uint32_t>(state.range(0));
+    const auto the_data = ParseJSONData(synthetic_data::MakeTiingoPriceHistoryJSON(how_many));
+
+    for (auto _ : state)
+    {
+        auto history = ConvertJSONPriceHistory("SYM", the_data, how_many, UseAdjusted::e_Yes,
+                                               static_cast<uint32_t>(state.range(1)));
+        benchmark::DoNotOptimize(history.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ConvertJSONPriceHistoryToColumns(benchmark::State &state)
+{
+    const auto how_many = static_cast<uint32_t>(state.range(0));
+    const auto the_data = ParseJSONData(synthetic_data::MakeTiingoPriceHistoryJSON(how_many));
+
+    for (auto _ : state)
+    {
+        auto history = ConvertJSONPriceHistoryToColumns("SYM", the_data, how_many, UseAdjusted::e_Yes);
+        benchmark::DoNotOptimize(history.GetCloses().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// these include the JSON parse since skipping it is the point.
+
+void BM_ParseThenConvertJSONPriceHistory(benchmark::State &state)
+{
+    const auto how_many = static_cast<uint32_t>(state.range(0));
+    const auto json_text = synthetic_data::MakeTiingoPriceHistoryJSON(how_many);
+
+    for (auto _ : state)
+    {
+        auto history = ConvertJSONPriceHistory("SYM", ParseJSONData(json_text), how_many, UseAdjusted::e_Yes);
+        benchmark::DoNotOptimize(history.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json_text.size()));
+}
+
+void BM_ParseJSONPriceHistory(benchmark::State &state)
+{
+    const auto how_many = static_cast<uint32_t>(state.range(0));
+    const auto json_text = synthetic_data::MakeTiingoPriceHistoryJSON(how_many);
+
+    for (auto _ : state)
+    {
+        auto history = ParseJSONPriceHistory("SYM", json_text, how_many, UseAdjusted::e_Yes);
+        benchmark::DoNotOptimize(history.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json_text.size()));
+}
+
+void BM_ParseJSONPriceHistoryToColumns(benchmark::State &state)
+{
+    const auto how_many = static_cast<uint32_t>(state.range(0));
+    const auto json_text = synthetic_data::MakeTiingoPriceHistoryJSON(how_many);
+
+    for (auto _ : state)
+    {
+        auto history = ParseJSONPriceHistoryToColumns("SYM", json_text, how_many, UseAdjusted::e_Yes);
+        benchmark::DoNotOptimize(history.GetCloses().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json_text.size()));
+}
+
+// peak memory of each way from JSON text to records.  The time is for a fork and one
+// conversion so only the 'peak_rss_increase_kb' counter is worth comparing.
+
+template <bool Streaming> void BM_PeakRSSJSONPriceHistory(benchmark::State &state)
+{
+    const auto how_many = static_cast<uint32_t>(state.range(0));
+    const auto json_text = synthetic_data::MakeTiingoPriceHistoryJSON(how_many);
+
+    int64_t increase = -1;
+    for (auto _ : state)
+    {
+        increase = PeakRSSIncrease([&] {
+            if constexpr (Streaming)
+            {
+                auto history = ParseJSONPriceHistory("SYM", json_text, how_many, UseAdjusted::e_Yes);
+                benchmark::DoNotOptimize(history.data());
+            }
+            else
+            {
+                auto history =
+                    ConvertJSONPriceHistory("SYM", ParseJSONData(json_text), how_many, UseAdjusted::e_Yes);
+                benchmark::DoNotOptimize(history.data());
+            }
+        });
+    }
+    if (increase < 0)
+    {
+        state.SkipWithError("Couldn't measure peak memory.");
+        return;
+    }
+    state.counters["peak_rss_increase_kb"] = benchmark::Counter(static_cast<double>(increase));
+    state.counters["json_kb"] = benchmark::Counter(static_cast<double>(json_text.size()) / 1024.0);
+}
+} // namespace
+
+BENCHMARK(BM_ConvertJSONPriceHistory)->Arg(250)->Arg(5'000)->Arg(50'000);
+BENCHMARK(BM_ConvertJSONPriceHistoryThreads)
+    ->ArgsProduct({{5'000, 50'000}, {1, 2, 4, 8, 16}})
+    ->ArgNames({"rows", "threads"})
+    ->UseRealTime();
+BENCHMARK(BM_ConvertJSONPriceHistoryToColumns)->Arg(250)->Arg(5'000)->Arg(50'000);
+BENCHMARK(BM_ParseThenConvertJSONPriceHistory)->Arg(250)->Arg(5'000);
+BENCHMARK(BM_ParseJSONPriceHistory)->Arg(250)->Arg(5'000);
+BENCHMARK(BM_ParseJSONPriceHistoryToColumns)->Arg(250)->Arg(5'000);
+BENCHMARK(BM_PeakRSSJSONPriceHistory<false>)
+    ->Name("BM_PeakRSSJSONPriceHistory/DOM")
+    ->Arg(5'000)
+    ->Arg(50'000)
+    ->Iterations(1);
+BENCHMARK(BM_PeakRSSJSONPriceHistory<true>)
+    ->Name("BM_PeakRSSJSONPriceHistory/Streaming")
+    ->Arg(5'000)
+    ->Arg(50'000)
+    ->Iterations(1);
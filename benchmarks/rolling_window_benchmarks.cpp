@@ -0,0 +1,192 @@
+/* =====================================================================================
+ *
+ * Filename:  rolling_window_benchmarks.cpp
+ *
+ * Description:  Benchmarks for the rolling window kernels against the recompute
+ *               every window loops they replace.  The kernels are checked against
+ *               naive versions in tests/rolling_window_tests.cpp.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 17:02:44
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "rolling_window.h"
+#include "synthetic_data.h"
+
+namespace
+{
+constexpr size_t how_many_prices = 5'000;
+
+std::vector<double> MakeCloses(size_t how_many, uint32_t seed = synthetic_data::DefaultSeed)
+{
+    std::vector<double> result;
+    result.reserve(how_many);
+    for (const auto &price : synthetic_data::MakePrices(how_many, 2, seed))
+    {
+        result.push_back(static_cast<double>(price));
+    }
+    return result;
+}
+
+// --- the naive versions: every window computed from scratch ---
+
+std::vector<double> NaiveRollingMean(std::span<const double> values, size_t window)
+{
+    std::vector<double> result;
+    for (size_t i = 0; i + window <= values.size(); ++i)
+    {
+        double sum = 0.0;
+        for (size_t k = i; k < i + window; ++k)
+        {
+            sum += values[k];
+        }
+        result.push_back(sum / static_cast<double>(window));
+    }
+    return result;
+}
+
+std::vector<double> NaiveRollingMin(std::span<const double> values, size_t window)
+{
+    std::vector<double> result;
+    for (size_t i = 0; i + window <= values.size(); ++i)
+    {
+        result.push_back(*std::min_element(values.begin() + i, values.begin() + i + window));
+    }
+    return result;
+}
+
+std::vector<double> NaiveRollingStdDev(std::span<const double> values, size_t window)
+{
+    std::vector<double> result;
+    for (size_t i = 0; i + window <= values.size(); ++i)
+    {
+        double sum = 0.0;
+        for (size_t k = i; k < i + window; ++k)
+        {
+            sum += values[k];
+        }
+        const double mean = sum / static_cast<double>(window);
+        double squares = 0.0;
+        for (size_t k = i; k < i + window; ++k)
+        {
+            squares += (values[k] - mean) * (values[k] - mean);
+        }
+        result.push_back(window > 1 ? std::sqrt(squares / static_cast<double>(window - 1)) : 0.0);
+    }
+    return result;
+}
+
+std::vector<double> NaiveSimpleReturns(std::span<const double> values)
+{
+    std::vector<double> result;
+    for (size_t i = 1; i < values.size(); ++i)
+    {
+        result.push_back(values[i] / values[i - 1] - 1.0);
+    }
+    return result;
+}
+
+// range(0) is the window.
+
+template <auto Kernel> void BM_Rolling(benchmark::State &state)
+{
+    const auto closes = MakeCloses(how_many_prices);
+    const auto window = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        auto result = Kernel(closes, window);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(closes.size()));
+}
+
+template <auto Naive> void BM_RollingNaive(benchmark::State &state)
+{
+    const auto closes = MakeCloses(how_many_prices);
+    const auto window = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        auto result = Naive(closes, window);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(closes.size()));
+}
+
+std::vector<double> KernelMean(std::span<const double> values, size_t window)
+{
+    return RollingMean(values, window);
+}
+std::vector<double> KernelMin(std::span<const double> values, size_t window)
+{
+    return RollingMin(values, window);
+}
+std::vector<double> KernelStdDev(std::span<const double> values, size_t window)
+{
+    return RollingStdDev(values, window);
+}
+
+void BM_SimpleReturns(benchmark::State &state)
+{
+    const auto closes = MakeCloses(how_many_prices);
+    for (auto _ : state)
+    {
+        auto result = SimpleReturns(closes);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(closes.size()));
+}
+
+void BM_SimpleReturnsNaive(benchmark::State &state)
+{
+    const auto closes = MakeCloses(how_many_prices);
+    for (auto _ : state)
+    {
+        auto result = NaiveSimpleReturns(closes);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(closes.size()));
+}
+
+// 500 symbols, 50 day moving average. range(0) is the thread count.
+
+void BM_ComputeRollingBatch(benchmark::State &state)
+{
+    std::vector<std::vector<double>> series;
+    for (uint32_t s = 0; s < 500; ++s)
+    {
+        series.push_back(MakeCloses(how_many_prices, synthetic_data::DefaultSeed + s));
+    }
+    for (auto _ : state)
+    {
+        auto results =
+            ComputeRollingBatch(RollingStatistic::e_Mean, series, 50, static_cast<uint32_t>(state.range(0)));
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(series.size() * how_many_prices));
+}
+} // namespace
+
+BENCHMARK(BM_Rolling<KernelMean>)->Arg(20)->Arg(200);
+BENCHMARK(BM_RollingNaive<NaiveRollingMean>)->Arg(20)->Arg(200);
+BENCHMARK(BM_Rolling<KernelMin>)->Arg(20)->Arg(200);
+BENCHMARK(BM_RollingNaive<NaiveRollingMin>)->Arg(20)->Arg(200);
+BENCHMARK(BM_Rolling<KernelStdDev>)->Arg(20)->Arg(200);
+BENCHMARK(BM_RollingNaive<NaiveRollingStdDev>)->Arg(20)->Arg(200);
+BENCHMARK(BM_SimpleReturns);
+BENCHMARK(BM_SimpleReturnsNaive);
+BENCHMARK(BM_ComputeRollingBatch)->Arg(1)->Arg(4)->Arg(8)->UseRealTime();
@@ -0,0 +1,137 @@
+/* =====================================================================================
+ *
+ * Filename:  split_string_benchmarks.cpp
+ *
+ * Description:  Benchmarks for the string splitting and delimited text code.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 10:02:18
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+
+#include "delimited_fields.h"
+#include "synthetic_data.h"
+#include "utilities.h"
+
+namespace
+{
+template <typename T> void BM_split_string(benchmark::State &state, std::string_view delim)
+{
+    const auto text = synthetic_data::MakeDelimitedText(static_cast<size_t>(state.range(0)), delim);
+    for (auto _ : state)
+    {
+        auto items = split_string<T>(text, delim);
+        benchmark::DoNotOptimize(items.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+template <typename T> void BM_rng_split_string(benchmark::State &state, std::string_view delim)
+{
+    const auto text = synthetic_data::MakeDelimitedText(static_cast<size_t>(state.range(0)), delim);
+    for (auto _ : state)
+    {
+        size_t total = 0;
+        for (const auto &item : rng_split_string<T>(text, delim))
+        {
+            total += item.size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+void BM_split_string_for_each(benchmark::State &state, std::string_view delim)
+{
+    const auto text = synthetic_data::MakeDelimitedText(static_cast<size_t>(state.range(0)), delim);
+    for (auto _ : state)
+    {
+        size_t total = 0;
+        split_string_for_each(text, delim, [&total](std::string_view item) { total += item.size(); });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+void BM_DelimitedFields(benchmark::State &state, std::string_view delim)
+{
+    const auto text = synthetic_data::MakeDelimitedText(static_cast<size_t>(state.range(0)), delim);
+    for (auto _ : state)
+    {
+        size_t total = 0;
+        for (const auto item : DelimitedFields{text, delim})
+        {
+            total += item.size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+// pull 2 of the 7 columns out of each CSV row.
+
+void BM_CSVSelectFields(benchmark::State &state)
+{
+    const auto text = synthetic_data::MakeCSVPriceRows(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        size_t total = 0;
+        for (const auto line : DelimitedLines{text, FieldQuoting::e_RFC4180})
+        {
+            const auto [date, close] = select_fields<0, 5>(DelimitedFields{line, ",", FieldQuoting::e_RFC4180});
+            total += date.size() + close.size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+// the same job the old way: getline then split every field into strings.
+
+void BM_CSVGetlineAndSplit(benchmark::State &state)
+{
+    const auto text = synthetic_data::MakeCSVPriceRows(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        size_t total = 0;
+        std::istringstream input{text};
+        std::string line;
+        while (std::getline(input, line))
+        {
+            const auto fields = split_string<std::string>(line, ",");
+            total += fields[0].size() + fields[5].size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+} // namespace
+
+BENCHMARK_CAPTURE(BM_split_string<std::string>, comma, ",")->RangeMultiplier(10)->Range(100, 100'000);
+BENCHMARK_CAPTURE(BM_split_string<std::string_view>, comma, ",")->RangeMultiplier(10)->Range(100, 100'000);
+BENCHMARK_CAPTURE(BM_split_string<std::string_view>, multi_char, "::")->RangeMultiplier(10)->Range(100, 100'000);
+BENCHMARK_CAPTURE(BM_rng_split_string<std::string>, comma, ",")->RangeMultiplier(10)->Range(100, 100'000);
+BENCHMARK_CAPTURE(BM_rng_split_string<std::string_view>, comma, ",")->RangeMultiplier(10)->Range(100, 100'000);
+BENCHMARK_CAPTURE(BM_split_string_for_each, comma, ",")->RangeMultiplier(10)->Range(100, 100'000);
+BENCHMARK_CAPTURE(BM_DelimitedFields, comma, ",")->RangeMultiplier(10)->Range(100, 100'000);
+BENCHMARK_CAPTURE(BM_DelimitedFields, multi_char, "::")->RangeMultiplier(10)->Range(100, 100'000);
+BENCHMARK(BM_CSVSelectFields)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(BM_CSVGetlineAndSplit)->RangeMultiplier(10)->Range(1'000, 100'000);
@@ -0,0 +1,239 @@
+/* =====================================================================================
+ *
+ * Filename:  streaming_benchmarks.cpp
+ *
+ * Description:  Benchmarks for the streamed price containers, tick ingestion and
+ *               time bar building.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 12:08:13
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "concurrent_tick_ingestor.h"
+#include "price_bar_builder.h"
+#include "streamed_prices_ring.h"
+#include "symbol_registry.h"
+#include "synthetic_data.h"
+#include "utilities.h"
+
+namespace
+{
+// keeping the most recent N prices: erase from the front of vectors vs a ring.
+
+void BM_StreamedPricesWindow(benchmark::State &state)
+{
+    const auto window = static_cast<size_t>(state.range(0));
+    StreamedPrices prices;
+    int64_t now = 0;
+    for (auto _ : state)
+    {
+        prices.timestamp_seconds_.push_back(now);
+        prices.price_.push_back(100.0 + static_cast<double>(now % 50));
+        prices.signal_type_.push_back(0);
+        if (prices.price_.size() > window)
+        {
+            prices.timestamp_seconds_.erase(prices.timestamp_seconds_.begin());
+            prices.price_.erase(prices.price_.begin());
+            prices.signal_type_.erase(prices.signal_type_.begin());
+        }
+        ++now;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_StreamedPricesRing(benchmark::State &state)
+{
+    StreamedPricesRing prices{static_cast<size_t>(state.range(0))};
+    int64_t now = 0;
+    for (auto _ : state)
+    {
+        prices.Append(now, 100.0 + static_cast<double>(now % 50), 0);
+        ++now;
+    }
+    benchmark::DoNotOptimize(prices.GetView().price_.data());
+    state.SetItemsProcessed(state.iterations());
+}
+
+// per tick lookup of a symbol's data: std::map by string vs registry ID.
+
+void BM_SymbolLookup_Map(benchmark::State &state)
+{
+    const auto symbols = synthetic_data::MakeSymbols(static_cast<size_t>(state.range(0)));
+    PF_StreamedSummary summaries;
+    for (const auto &symbol : symbols)
+    {
+        summaries[symbol] = {};
+    }
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        auto &summary = summaries[symbols[i++ % symbols.size()]];
+        summary.latest_price_ += 1.0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SymbolLookup_Table(benchmark::State &state)
+{
+    const auto symbols = synthetic_data::MakeSymbols(static_cast<size_t>(state.range(0)));
+    SymbolRegistry registry;
+    PF_StreamedSummaryTable summaries{registry};
+    for (const auto &symbol : symbols)
+    {
+        summaries[symbol] = {};
+    }
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        auto &summary = summaries[std::string_view{symbols[i++ % symbols.size()]}];
+        summary.latest_price_ += 1.0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SymbolLookup_ID(benchmark::State &state)
+{
+    const auto symbols = synthetic_data::MakeSymbols(static_cast<size_t>(state.range(0)));
+    SymbolRegistry registry;
+    PF_StreamedSummaryTable summaries{registry};
+    for (const auto &symbol : symbols)
+    {
+        summaries[symbol] = {};
+    }
+    SymbolID id = 0;
+    for (auto _ : state)
+    {
+        auto &summary = summaries[id];
+        summary.latest_price_ += 1.0;
+        id = id + 1 == symbols.size() ? 0 : id + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// several feed threads pushing ticks for 100 symbols while thread 0 also drains.
+// Ticks pushed while a queue is full are dropped and reported separately.
+
+constexpr size_t how_many_symbols = 100;
+std::unique_ptr<ConcurrentTickIngestor> shared_ingestor;
+
+void BM_ConcurrentTickIngestor(benchmark::State &state)
+{
+    if (state.thread_index() == 0)
+    {
+        shared_ingestor = std::make_unique<ConcurrentTickIngestor>(how_many_symbols, 4096);
+    }
+    auto id = static_cast<SymbolID>(state.thread_index());
+    int64_t now = 0;
+    size_t drained = 0;
+    int64_t dropped = 0;
+    for (auto _ : state)
+    {
+        if (!shared_ingestor->PushTick(id, {now, 100.0 + static_cast<double>(now % 50), 0}))
+        {
+            ++dropped;
+        }
+        id = (id + 1) % how_many_symbols;
+        ++now;
+        if (state.thread_index() == 0 && now % 64 == 0)
+        {
+            for (SymbolID s = 0; s < how_many_symbols; ++s)
+            {
+                drained += shared_ingestor->DrainTicks(s, [](const StreamedTick &) {});
+            }
+        }
+    }
+    benchmark::DoNotOptimize(drained);
+
+    // only ticks which made it into a queue count. The drops are summed over the threads.
+
+    state.SetItemsProcessed(state.iterations() - dropped);
+    state.counters["dropped"] = benchmark::Counter(static_cast<double>(dropped));
+}
+
+// per tick cost of keeping 1 minute (and 5 and 15 minute) bars current for 100 symbols.
+// A tick every second starting at the 2025-03-03 open.
+
+constexpr int64_t bars_start_seconds = 1'741'012'200;
+
+void BM_PriceBarBuilder(benchmark::State &state)
+{
+    const std::vector<std::chrono::seconds> all_widths{std::chrono::minutes{1}, std::chrono::minutes{5},
+                                                       std::chrono::minutes{15}};
+    size_t completed = 0;
+    PriceBarBuilder builder{std::span{all_widths}.first(static_cast<size_t>(state.range(0))),
+                            [&completed](SymbolID, const PriceBar &) { ++completed; }};
+    int64_t now = bars_start_seconds;
+    SymbolID id = 0;
+    for (auto _ : state)
+    {
+        builder.AddTick(id, now, 100.0 + static_cast<double>(now % 50));
+        if (++id == how_many_symbols)
+        {
+            id = 0;
+            ++now;
+        }
+    }
+    benchmark::DoNotOptimize(completed);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// what we did before: rebuild the 1 minute bars from all the collected prices
+// whenever they're needed. range(0) is the number of prices collected.
+
+void BM_RescanBars(benchmark::State &state)
+{
+    StreamedPrices prices;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        prices.timestamp_seconds_.push_back(bars_start_seconds + i);
+        prices.price_.push_back(100.0 + static_cast<double>(i % 50));
+    }
+    std::vector<PriceBar> bars;
+    for (auto _ : state)
+    {
+        bars.clear();
+        for (size_t i = 0; i < prices.price_.size(); ++i)
+        {
+            const auto start = prices.timestamp_seconds_[i] - (prices.timestamp_seconds_[i] - bars_start_seconds) % 60;
+            const auto price = prices.price_[i];
+            if (bars.empty() || bars.back().start_seconds_ != start)
+            {
+                bars.push_back({start, 60, price, price, price, price, 1});
+                continue;
+            }
+            auto &bar = bars.back();
+            bar.high_ = std::max(bar.high_, price);
+            bar.low_ = std::min(bar.low_, price);
+            bar.close_ = price;
+            ++bar.tick_count_;
+        }
+        benchmark::DoNotOptimize(bars.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(BM_StreamedPricesWindow)->Arg(1'000)->Arg(10'000);
+BENCHMARK(BM_StreamedPricesRing)->Arg(1'000)->Arg(10'000);
+BENCHMARK(BM_SymbolLookup_Map)->Arg(100)->Arg(5'000);
+BENCHMARK(BM_SymbolLookup_Table)->Arg(100)->Arg(5'000);
+BENCHMARK(BM_SymbolLookup_ID)->Arg(100)->Arg(5'000);
+BENCHMARK(BM_ConcurrentTickIngestor)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_PriceBarBuilder)->DenseRange(1, 3);
+BENCHMARK(BM_RescanBars)->Arg(1'000)->Arg(23'400);
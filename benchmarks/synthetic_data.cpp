@@ -0,0 +1,258 @@
+/* =====================================================================================
+ *
+ * Filename:  synthetic_data.cpp
+ *
+ * Description:  Implementation of the benchmark data generators.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 09:31:05
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <unistd.h>
+
+#include "synthetic_data.h"
+
+namespace
+{
+constexpr std::string_view item_chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+
+// a random walk so generated price histories look roughly like the real thing.
+
+class PriceWalk
+{
+public:
+    explicit PriceWalk(uint32_t seed) : generator_{seed}
+    {
+    }
+
+    double Next()
+    {
+        price_ = std::max(1.0, price_ * (1.0 + step_(generator_)));
+        return price_;
+    }
+    double Jitter(double price)
+    {
+        return price * (1.0 + std::abs(step_(generator_)));
+    }
+
+private:
+    std::mt19937 generator_;
+    std::normal_distribution<double> step_{0.0, 0.015};
+    double price_ = 100.0;
+};
+} // namespace
+
+namespace synthetic_data
+{
+std::string MakeDelimitedText(size_t how_many_items, std::string_view delim, uint32_t seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<size_t> item_length{1, 12};
+    std::uniform_int_distribution<size_t> which_char{0, item_chars.size() - 1};
+
+    std::string result;
+    result.reserve(how_many_items * (7 + delim.size()));
+    for (size_t i = 0; i < how_many_items; ++i)
+    {
+        if (i > 0)
+        {
+            result += delim;
+        }
+        for (auto n = item_length(generator); n > 0; --n)
+        {
+            result += item_chars[which_char(generator)];
+        }
+    }
+    return result;
+} // -----  end of function MakeDelimitedText  -----
+
+std::string MakeCSVPriceRows(size_t how_many_rows, uint32_t seed)
+{
+    PriceWalk walk{seed};
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<int64_t> volume{1'000, 50'000'000};
+
+    std::string result;
+    auto day = std::chrono::sys_days{std::chrono::year{2000} / 1 / 3};
+    for (size_t i = 0; i < how_many_rows; ++i, day += std::chrono::days{1})
+    {
+        const auto close = walk.Next();
+        const auto quote = i % 8 == 0 ? "\"" : "";
+        std::format_to(std::back_inserter(result), "{:%F},{}SYM{}{},{:.4f},{:.4f},{:.4f},{:.4f},{}\n", day, quote,
+                       i % 97, quote, walk.Jitter(close), walk.Jitter(close) * 1.01, close * 0.99, close,
+                       volume(generator));
+    }
+    return result;
+} // -----  end of function MakeCSVPriceRows  -----
+
+std::string MakeTiingoPriceHistoryJSON(size_t how_many_rows, uint32_t seed)
+{
+    PriceWalk walk{seed};
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<int64_t> volume{1'000, 50'000'000};
+
+    // newest first, like Tiingo gives it to us.
+
+    auto day = std::chrono::sys_days{std::chrono::year{2025} / 12 / 31};
+
+    std::string result{"["};
+    result.reserve(how_many_rows * 330);
+    for (size_t i = 0; i < how_many_rows; ++i, day -= std::chrono::days{1})
+    {
+        const auto close = walk.Next();
+        const auto open = walk.Jitter(close);
+        const auto high = std::max(open, close) * 1.01;
+        const auto low = std::min(open, close) * 0.99;
+        std::format_to(std::back_inserter(result),
+                       R"({}{{"date":"{:%F}T00:00:00.000Z","open":"{:.4f}","high":"{:.4f}","low":"{:.4f}",)"
+                       R"("close":"{:.4f}","volume":"{}","adjOpen":"{:.4f}","adjHigh":"{:.4f}","adjLow":"{:.4f}",)"
+                       R"("adjClose":"{:.4f}","adjVolume":"{}","divCash":"0.0","splitFactor":"1.0"}})",
+                       i == 0 ? "" : ",", day, open, high, low, close, volume(generator), open * 0.98,
+                       high * 0.98, low * 0.98, close * 0.98, volume(generator));
+    }
+    result += "]";
+    return result;
+} // -----  end of function MakeTiingoPriceHistoryJSON  -----
+
+std::vector<std::chrono::year_month_day> MakeRandomDays(size_t how_many, std::chrono::year first_year,
+                                                        std::chrono::year last_year, uint32_t seed)
+{
+    const auto first = std::chrono::sys_days{first_year / 1 / 1}.time_since_epoch().count();
+    const auto last = std::chrono::sys_days{last_year / 12 / 31}.time_since_epoch().count();
+
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<int32_t> which_day{first, last};
+
+    std::vector<std::chrono::year_month_day> result;
+    result.reserve(how_many);
+    for (size_t i = 0; i < how_many; ++i)
+    {
+        result.emplace_back(std::chrono::sys_days{std::chrono::days{which_day(generator)}});
+    }
+    return result;
+} // -----  end of function MakeRandomDays  -----
+
+std::vector<std::string> MakeDateStrings(size_t how_many, uint32_t seed)
+{
+    std::vector<std::string> result;
+    result.reserve(how_many);
+    for (const auto &day : MakeRandomDays(how_many, std::chrono::year{1990}, std::chrono::year{2030}, seed))
+    {
+        result.push_back(std::format("{:%F}", day));
+    }
+    return result;
+} // -----  end of function MakeDateStrings  -----
+
+std::vector<std::string> MakeTimeStampStrings(size_t how_many, uint32_t seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<int32_t> second_of_day{0, 86'399};
+
+    std::vector<std::string> result;
+    result.reserve(how_many);
+    for (const auto &day : MakeRandomDays(how_many, std::chrono::year{1990}, std::chrono::year{2030}, seed))
+    {
+        const auto when = std::chrono::sys_days{day} + std::chrono::seconds{second_of_day(generator)};
+        result.push_back(std::format("{:%FT%T}", when));
+    }
+    return result;
+} // -----  end of function MakeTimeStampStrings  -----
+
+std::vector<std::string> MakePriceStrings(size_t how_many, int32_t fractional_digits, uint32_t seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_real_distribution<double> price{1.0, 5000.0};
+
+    std::vector<std::string> result;
+    result.reserve(how_many);
+    for (size_t i = 0; i < how_many; ++i)
+    {
+        result.push_back(std::format("{:.{}f}", price(generator), fractional_digits));
+    }
+    return result;
+} // -----  end of function MakePriceStrings  -----
+
+std::vector<Decimal> MakePrices(size_t how_many, int32_t fractional_digits, uint32_t seed)
+{
+    std::vector<Decimal> result;
+    result.reserve(how_many);
+    for (const auto &price : MakePriceStrings(how_many, fractional_digits, seed))
+    {
+        result.emplace_back(price.c_str());
+    }
+    return result;
+} // -----  end of function MakePrices  -----
+
+std::vector<std::string> MakeSymbols(size_t how_many)
+{
+    std::vector<std::string> result;
+    result.reserve(how_many);
+    for (size_t i = 0; i < how_many; ++i)
+    {
+        result.push_back(std::format("SYM{}", i));
+    }
+    return result;
+} // -----  end of function MakeSymbols  -----
+
+std::vector<MultiSymbolDateCloseRecord> MakeMultiSymbolDateCloseRecords(size_t how_many_symbols, size_t how_many_days,
+                                                                        uint32_t seed)
+{
+    const auto symbols = MakeSymbols(how_many_symbols);
+    std::vector<PriceWalk> walks;
+    walks.reserve(how_many_symbols);
+    for (size_t i = 0; i < how_many_symbols; ++i)
+    {
+        walks.emplace_back(seed + static_cast<uint32_t>(i));
+    }
+
+    std::vector<MultiSymbolDateCloseRecord> result;
+    result.reserve(how_many_symbols * how_many_days);
+    const auto first_day = std::chrono::sys_days{std::chrono::year{2015} / 1 / 2};
+    for (size_t d = 0; d < how_many_days; ++d)
+    {
+        const auto when = std::chrono::utc_clock::from_sys(first_day + std::chrono::days{d} + std::chrono::hours{21});
+        for (size_t s = 0; s < how_many_symbols; ++s)
+        {
+            result.push_back({symbols[s], when, Decimal{std::format("{:.2f}", walks[s].Next()).c_str()}});
+        }
+    }
+    return result;
+} // -----  end of function MakeMultiSymbolDateCloseRecords  -----
+
+TemporaryDirectory::TemporaryDirectory()
+{
+    static std::atomic<uint32_t> counter{0};
+    path_ = fs::temp_directory_path() / std::format("common_utilities_bench_{}_{}", ::getpid(), counter++);
+    fs::create_directories(path_);
+} // -----  end of method TemporaryDirectory::TemporaryDirectory  -----
+
+TemporaryDirectory::~TemporaryDirectory()
+{
+    std::error_code ec;
+    fs::remove_all(path_, ec);
+} // -----  end of method TemporaryDirectory::~TemporaryDirectory  -----
+
+fs::path TemporaryDirectory::WriteFile(const fs::path &file_name, std::string_view contents) const
+{
+    const auto full_name = path_ / file_name;
+    std::ofstream output_file{full_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc};
+    BOOST_ASSERT_MSG(output_file.is_open(), std::format("Can't create benchmark file: {}.", full_name).c_str());
+    output_file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    return full_name;
+} // -----  end of method TemporaryDirectory::WriteFile  -----
+
+} // namespace synthetic_data
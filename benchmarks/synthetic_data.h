@@ -0,0 +1,123 @@
+/* =====================================================================================
+ *
+ * Filename:  synthetic_data.h
+ *
+ * Description:  Generators for the repeatable, synthetic data our benchmarks use.
+ *               Everything is seeded so runs can be compared across commits.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 09:12:44
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef SYNTHETIC_DATA_H_
+#define SYNTHETIC_DATA_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utilities.h"
+
+namespace synthetic_data
+{
+inline constexpr uint32_t DefaultSeed = 20260817;
+
+// 'how_many_items' random alphanumeric items of 1 to 12 characters separated by 'delim'.
+
+std::string MakeDelimitedText(size_t how_many_items, std::string_view delim, uint32_t seed = DefaultSeed);
+
+// CSV price rows: date,symbol,open,high,low,close,volume -- with some quoted symbols.
+
+std::string MakeCSVPriceRows(size_t how_many_rows, uint32_t seed = DefaultSeed);
+
+// a Tiingo style daily price history: a JSON array of objects, newest first, with the
+// prices as strings the way ConvertJSONPriceHistory expects them.
+
+std::string MakeTiingoPriceHistoryJSON(size_t how_many_rows, uint32_t seed = DefaultSeed);
+
+// random days in [first_year, last_year] and their string forms.
+
+std::vector<std::chrono::year_month_day> MakeRandomDays(size_t how_many, std::chrono::year first_year,
+                                                        std::chrono::year last_year, uint32_t seed = DefaultSeed);
+
+// YYYY-MM-DD
+
+std::vector<std::string> MakeDateStrings(size_t how_many, uint32_t seed = DefaultSeed);
+
+// YYYY-MM-DDTHH:MM:SS
+
+std::vector<std::string> MakeTimeStampStrings(size_t how_many, uint32_t seed = DefaultSeed);
+
+// prices in [1, 5000) with 'fractional_digits' digits after the point, e.g. "123.4567"
+
+std::vector<std::string> MakePriceStrings(size_t how_many, int32_t fractional_digits, uint32_t seed = DefaultSeed);
+std::vector<Decimal> MakePrices(size_t how_many, int32_t fractional_digits, uint32_t seed = DefaultSeed);
+
+// SYM0, SYM1, ...
+
+std::vector<std::string> MakeSymbols(size_t how_many);
+
+// closing prices for several symbols, in date order, symbols interleaved.
+
+std::vector<MultiSymbolDateCloseRecord> MakeMultiSymbolDateCloseRecords(size_t how_many_symbols,
+                                                                        size_t how_many_days,
+                                                                        uint32_t seed = DefaultSeed);
+
+// =====================================================================================
+//        Class:  TemporaryDirectory
+//  Description:  A uniquely named directory under the system temp directory which is
+//                removed, with everything in it, when we go away.
+// =====================================================================================
+
+class TemporaryDirectory
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    TemporaryDirectory();
+    TemporaryDirectory(const TemporaryDirectory &rhs) = delete;
+    ~TemporaryDirectory();
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] const fs::path &GetPath() const
+    {
+        return path_;
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    fs::path WriteFile(const fs::path &file_name, std::string_view contents) const;
+
+    // ====================  OPERATORS     =======================================
+
+    TemporaryDirectory &operator=(const TemporaryDirectory &rhs) = delete;
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+    fs::path path_;
+
+}; // -----  end of class TemporaryDirectory  -----
+
+} // namespace synthetic_data
+
+#endif /* SYNTHETIC_DATA_H_ */
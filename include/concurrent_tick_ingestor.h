@@ -0,0 +1,273 @@
+/* =====================================================================================
+ *
+ * Filename:  concurrent_tick_ingestor.h
+ *
+ * Description:  Lock-free ingestion of streamed ticks from several feed threads.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 20:03:14
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef CONCURRENT_TICK_INGESTOR_H_
+#define CONCURRENT_TICK_INGESTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "streamed_prices_ring.h"
+#include "symbol_registry.h"
+#include "utilities.h"
+
+// one streamed price.
+
+struct StreamedTick
+{
+    int64_t timestamp_seconds_{0};
+    double price_{0.};
+    int32_t signal_type_{0};
+};
+
+// =====================================================================================
+//        Class:  BoundedMPSCQueue
+//  Description:  Fixed size queue for many producers and a single consumer.
+//                This is Dmitry Vyukov's bounded queue: each cell carries a sequence
+//                number which tells producers and the consumer whose turn it is.
+//                Neither side ever blocks; a full queue just refuses the push.
+// =====================================================================================
+
+template <typename T> class BoundedMPSCQueue
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    // capacity is rounded up to a power of 2.
+
+    explicit BoundedMPSCQueue(size_t capacity)
+        : cells_{std::make_unique<Cell[]>(std::bit_ceil(std::max(capacity, size_t{2})))},
+          mask_{std::bit_ceil(std::max(capacity, size_t{2})) - 1}
+    {
+        for (size_t i = 0; i <= mask_; ++i)
+        {
+            cells_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] size_t capacity() const
+    {
+        return mask_ + 1;
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    // safe to call from any number of threads.
+
+    bool TryPush(const T &value)
+    {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell &cell = cells_[pos & mask_];
+            const size_t seq = cell.sequence_.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    cell.data_ = value;
+                    cell.sequence_.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // full
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // only one thread may pop.
+
+    bool TryPop(T &value)
+    {
+        Cell &cell = cells_[dequeue_pos_ & mask_];
+        const size_t seq = cell.sequence_.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(dequeue_pos_ + 1) < 0)
+        {
+            return false; // empty
+        }
+        value = cell.data_;
+        cell.sequence_.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+        ++dequeue_pos_;
+        return true;
+    }
+
+    // ====================  OPERATORS     =======================================
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence_;
+        T data_;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+
+    // keep producers and the consumer off each other's cache lines.
+
+    alignas(CacheLineSize) std::atomic<size_t> enqueue_pos_{0};
+    alignas(CacheLineSize) size_t dequeue_pos_{0};
+
+}; // -----  end of class BoundedMPSCQueue  -----
+
+// =====================================================================================
+//        Class:  SeqLockedSummary
+//  Description:  A StreamedSummary guarded by a sequence lock.  Writers take turns
+//                (briefly) by making the sequence odd.  Readers never block anyone;
+//                they just retry if a write happened while they were reading.
+// =====================================================================================
+
+class SeqLockedSummary
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    SeqLockedSummary() = default;
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] StreamedSummary Read() const;
+
+    // ====================  MUTATORS      =======================================
+
+    // the first price seen also becomes the opening price.
+
+    void Update(double latest_price, int32_t signal_type);
+
+    // ====================  OPERATORS     =======================================
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+    std::atomic<uint64_t> sequence_{0};
+    std::atomic<double> opening_price_{0.};
+    std::atomic<double> latest_price_{0.};
+    std::atomic<int32_t> signal_type_{0};
+    std::atomic<bool> have_opening_price_{false};
+
+}; // -----  end of class SeqLockedSummary  -----
+
+// =====================================================================================
+//        Class:  ConcurrentTickIngestor
+//  Description:  Per symbol summary and tick queue for a fixed set of symbols.
+//                Feed threads call PushTick concurrently.  Any thread may read the
+//                summaries.  One thread (e.g. the charting thread) drains the ticks
+//                into its own StreamedPrices/StreamedPricesRing.
+// =====================================================================================
+
+class ConcurrentTickIngestor
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    // IDs [0, how_many_symbols) are valid -- typically from a SymbolRegistry filled in up front.
+
+    ConcurrentTickIngestor(size_t how_many_symbols, size_t queue_capacity_per_symbol);
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] size_t size() const
+    {
+        return symbols_.size();
+    }
+
+    [[nodiscard]] StreamedSummary GetSummary(SymbolID id) const
+    {
+        return symbols_[id]->summary_.Read();
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    // the summary is always updated. Returns false if the tick queue was full and
+    // the tick itself was dropped.
+
+    bool PushTick(SymbolID id, const StreamedTick &tick);
+
+    // consumer side. Only one thread may drain a given symbol.
+
+    template <typename Func> size_t DrainTicks(SymbolID id, Func &&func)
+    {
+        size_t how_many = 0;
+        StreamedTick tick;
+        while (symbols_[id]->ticks_.TryPop(tick))
+        {
+            func(tick);
+            ++how_many;
+        }
+        return how_many;
+    }
+
+    size_t DrainTicks(SymbolID id, StreamedPricesRing &prices);
+    size_t DrainTicks(SymbolID id, StreamedPrices &prices);
+
+    // ====================  OPERATORS     =======================================
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+    struct alignas(CacheLineSize) PerSymbol
+    {
+        explicit PerSymbol(size_t queue_capacity) : ticks_{queue_capacity}
+        {
+        }
+
+        SeqLockedSummary summary_;
+        BoundedMPSCQueue<StreamedTick> ticks_;
+    };
+
+    std::vector<std::unique_ptr<PerSymbol>> symbols_;
+
+}; // -----  end of class ConcurrentTickIngestor  -----
+
+#endif /* CONCURRENT_TICK_INGESTOR_H_ */
@@ -0,0 +1,261 @@
+/* =====================================================================================
+ *
+ * Filename:  date_close_grouper.h
+ *
+ * Description:  Regroup large multi symbol date/close data sets into per symbol,
+ *               date ordered series.  Sorts with a radix sort on a
+ *               (symbol ID, date) key and spills sorted runs to disk when the data
+ *               won't fit in a given memory budget.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 17:48:15
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef DATE_CLOSE_GROUPER_H_
+#define DATE_CLOSE_GROUPER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "symbol_registry.h"
+#include "utilities.h"
+
+struct DateCloseGrouperOptions
+{
+    // roughly how much memory the rows waiting to be sorted may use before they are
+    // sorted and written to a temporary file.
+
+    size_t memory_budget_bytes_ = size_t{1} << 30;
+
+    // where the temporary files go. Empty means fs::temp_directory_path().
+
+    fs::path temporary_directory_;
+};
+
+// =====================================================================================
+//        Class:  GroupedDateCloses
+//  Description:  The dates and closes of every symbol, grouped by symbol and in date
+//                order within each symbol, stored as 2 columns.  Symbols are numbered
+//                in the order they were first seen.  The per symbol spans point into
+//                the columns.
+// =====================================================================================
+
+class GroupedDateCloses
+{
+public:
+    using UTC_TimePoint = std::chrono::utc_clock::time_point;
+
+    // ====================  LIFECYCLE     =======================================
+
+    GroupedDateCloses() = default;
+    GroupedDateCloses(const GroupedDateCloses &rhs) = delete;
+    GroupedDateCloses(GroupedDateCloses &&rhs) = default;
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] size_t size() const
+    {
+        return dates_.size();
+    }
+    [[nodiscard]] bool empty() const
+    {
+        return dates_.empty();
+    }
+
+    [[nodiscard]] size_t GetSymbolCount() const
+    {
+        return registry_.size();
+    }
+    [[nodiscard]] std::string_view GetSymbol(SymbolID id) const
+    {
+        return registry_.GetSymbol(id);
+    }
+    [[nodiscard]] std::optional<SymbolID> FindSymbol(std::string_view symbol) const
+    {
+        return registry_.Find(symbol);
+    }
+
+    [[nodiscard]] std::span<const UTC_TimePoint> GetDates(SymbolID id) const
+    {
+        return std::span{dates_}.subspan(offsets_[id], offsets_[id + 1] - offsets_[id]);
+    }
+    [[nodiscard]] std::span<const Decimal> GetCloses(SymbolID id) const
+    {
+        return std::span{closes_}.subspan(offsets_[id], offsets_[id + 1] - offsets_[id]);
+    }
+
+    // func(symbol, dates, closes) for each symbol in ID order.
+
+    template <typename Func> void ForEachSymbol(Func &&func) const
+    {
+        for (SymbolID id = 0; id < GetSymbolCount(); ++id)
+        {
+            func(GetSymbol(id), GetDates(id), GetCloses(id));
+        }
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    // ====================  OPERATORS     =======================================
+
+    GroupedDateCloses &operator=(const GroupedDateCloses &rhs) = delete;
+    GroupedDateCloses &operator=(GroupedDateCloses &&rhs) = default;
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    friend class DateCloseGrouper;
+
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+    // the registry's symbol views point into its own map nodes so it can be moved
+    // but not copied. Hence no copying for us either.
+
+    SymbolRegistry registry_;
+
+    std::vector<UTC_TimePoint> dates_;
+    std::vector<Decimal> closes_;
+
+    // one more entry than there are symbols. Symbol i is rows [offsets_[i], offsets_[i + 1]).
+
+    std::vector<size_t> offsets_;
+
+}; // -----  end of class GroupedDateCloses  -----
+
+// func(symbol, dates, closes) for one symbol's complete, date ordered series.
+
+using DateCloseGroupHandler = std::function<void(std::string_view symbol,
+                                                 std::span<const GroupedDateCloses::UTC_TimePoint> dates,
+                                                 std::span<const Decimal> closes)>;
+
+// =====================================================================================
+//        Class:  DateCloseGrouper
+//  Description:  Collects rows, interning each symbol as it arrives.  Rows are kept
+//                as (symbol ID, date, close) so the symbol string is stored once.
+//
+//                When the collected rows exceed the memory budget, they are radix
+//                sorted and written to a temporary file as a sorted run.  At the end
+//                the runs are merged.  If everything fit, the rows are simply sorted
+//                in memory.
+//
+//                Rows with the same symbol and date keep the order they were added in.
+// =====================================================================================
+
+class DateCloseGrouper
+{
+public:
+    using UTC_TimePoint = GroupedDateCloses::UTC_TimePoint;
+
+    // ====================  LIFECYCLE     =======================================
+
+    explicit DateCloseGrouper(DateCloseGrouperOptions options = {});
+    DateCloseGrouper(const DateCloseGrouper &rhs) = delete;
+
+    // removes any temporary files still around.
+
+    ~DateCloseGrouper();
+
+    // ====================  ACCESSORS     =======================================
+
+    // rows added since the last Finish.
+
+    [[nodiscard]] size_t size() const
+    {
+        return how_many_rows_;
+    }
+
+    // how many sorted runs have been written to disk so far.
+
+    [[nodiscard]] size_t GetRunCount() const
+    {
+        return run_files_.size();
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    void Add(std::string_view symbol, UTC_TimePoint date, Decimal close);
+    void Add(const MultiSymbolDateCloseRecord &record)
+    {
+        Add(record.symbol_, record.date_, record.close_);
+    }
+    void Add(std::span<const MultiSymbolDateCloseRecord> records);
+
+    // all the rows, grouped. The whole result is in memory (about 16 bytes a row).
+
+    GroupedDateCloses Finish();
+
+    // hand each symbol's series to 'handler' in symbol ID order. Only one symbol's
+    // series is in memory at a time so this stays within the budget (plus the
+    // largest single series) however big the data is.
+
+    void Finish(const DateCloseGroupHandler &handler);
+
+    // ====================  OPERATORS     =======================================
+
+    DateCloseGrouper &operator=(const DateCloseGrouper &rhs) = delete;
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // what we sort and what goes in the run files. The date is stored as a key with
+    // the sign bit flipped so that unsigned order is date order.
+
+    struct Row
+    {
+        uint64_t date_key_;
+        Decimal close_;
+        SymbolID symbol_id_;
+    };
+
+    // ====================  METHODS       =======================================
+
+    void SortRows(std::vector<Row> &rows);
+    void WriteRun();
+    void RemoveRunFiles();
+
+    // these visit every row in (symbol ID, date) order then start over empty.
+
+    template <typename Func> void ForEachSortedRow(Func &&func);
+    template <typename Func> void MergeRuns(Func &&func);
+
+    // ====================  DATA MEMBERS  =======================================
+
+    DateCloseGrouperOptions options_;
+    SymbolRegistry registry_;
+
+    std::vector<Row> rows_;
+    std::vector<Row> scratch_;
+    size_t max_rows_in_memory_;
+    size_t how_many_rows_ = 0;
+
+    std::vector<fs::path> run_files_;
+
+}; // -----  end of class DateCloseGrouper  -----
+
+// convenience for data which is already in memory.
+
+GroupedDateCloses GroupBySymbol(std::span<const MultiSymbolDateCloseRecord> records,
+                                DateCloseGrouperOptions options = {});
+
+#endif /* DATE_CLOSE_GROUPER_H_ */
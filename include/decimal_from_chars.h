@@ -0,0 +1,71 @@
+/* =====================================================================================
+ *
+ * Filename:  decimal_from_chars.h
+ *
+ * Description:  Fast from_chars style parsing of prices into Decimal.  Price fields
+ *               from our data sources are always plain [-]digits[.digits] so we
+ *               handle exactly that with integer arithmetic and pass anything else
+ *               on to the general Boost Decimal parser.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 21:36:09
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef DECIMAL_FROM_CHARS_H_
+#define DECIMAL_FROM_CHARS_H_
+
+#include <charconv>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+#include "utilities.h"
+
+// works like std::from_chars: parses as much of [first, last) as makes a number and
+// returns a pointer just past it.  On error, 'value' is unchanged and 'ec' says why.
+// Never throws.
+//
+// For [-]digits[.digits] with no more than 16 digits in all, the result is built
+// directly as Decimal{digits, -fraction digits} which is exactly what the general
+// parser (and so Decimal{const char *}) gives.  Anything else (exponents, more digits,
+// nan, inf, ...) goes to bd::from_chars.
+
+std::from_chars_result DecimalFromChars(const char *first, const char *last, Decimal &value) noexcept;
+
+// the whole of 'text' must be the number.
+
+inline std::errc DecimalFromChars(std::string_view text, Decimal &value) noexcept
+{
+    Decimal result;
+    const auto [ptr, ec] = DecimalFromChars(text.data(), text.data() + text.size(), result);
+    if (ec != std::errc{})
+    {
+        return ec;
+    }
+    if (ptr != text.data() + text.size())
+    {
+        return std::errc::invalid_argument;
+    }
+    value = result;
+    return ec;
+}
+
+// batch version: values[i] is set from fields[i].  'values' must be at least as long
+// as 'fields' (asserted, so not noexcept).  Stops at the first field which is not
+// entirely a number and returns its index.  Returns fields.size() if they are all good.
+
+size_t DecimalFromChars(std::span<const std::string_view> fields, std::span<Decimal> values);
+
+// the throwing version for when a bad price means bad data.
+
+Decimal StringToDecimal(std::string_view text);
+
+#endif /* DECIMAL_FROM_CHARS_H_ */
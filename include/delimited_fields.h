@@ -0,0 +1,296 @@
+/* =====================================================================================
+ *
+ * Filename:  delimited_fields.h
+ *
+ * Description:  Lazy, non-allocating tokenizers for delimited (CSV like) text.
+ *               Fields and lines are handed out as string_views into the caller's
+ *               buffer (a string, a MappedFile, etc.).
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 23:26:09
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef DELIMITED_FIELDS_H_
+#define DELIMITED_FIELDS_H_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "utilities.h"
+
+// with e_RFC4180, a field that starts with a double quote runs to the matching closing
+// quote, so it may contain delimiters (and, for DelimitedLines, newlines).  Inside it a
+// quote is written as 2 quotes.  The field we hand out is what's between the outer quotes
+// with the doubled quotes left as is -- use UnquoteField if you need them collapsed.
+
+enum class FieldQuoting : int32_t
+{
+    e_None,
+    e_RFC4180
+};
+
+// =====================================================================================
+//        Class:  DelimitedFields
+//  Description:  A forward range over the fields of one record.
+//                Unlike split_string, this follows CSV rules for counting fields:
+//                'a,,b,' has 4 fields, the last one empty.  An empty record has none.
+//                Single character delimiters use our vectorized char_search.
+// =====================================================================================
+
+class DelimitedFields : public std::ranges::view_interface<DelimitedFields>
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        iterator(const DelimitedFields *fields, const char *next) : fields_{fields}, next_{next}
+        {
+            at_end_ = !fields_->NextField(next_, field_);
+        }
+
+        std::string_view operator*() const
+        {
+            return field_;
+        }
+        iterator &operator++()
+        {
+            at_end_ = !fields_->NextField(next_, field_);
+            return *this;
+        }
+        iterator operator++(int)
+        {
+            auto temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const iterator &rhs) const
+        {
+            return at_end_ == rhs.at_end_ && (at_end_ || field_.data() == rhs.field_.data());
+        }
+        bool operator==(std::default_sentinel_t) const
+        {
+            return at_end_;
+        }
+
+    private:
+        const DelimitedFields *fields_ = nullptr;
+        const char *next_ = nullptr;
+        std::string_view field_;
+        bool at_end_ = true;
+    };
+
+    // ====================  LIFECYCLE     =======================================
+
+    DelimitedFields() = default;
+    DelimitedFields(std::string_view record, std::string_view delim, FieldQuoting quoting = FieldQuoting::e_None)
+        : record_{record}, delim_{delim}, quoting_{quoting}
+    {
+        BOOST_ASSERT_MSG(!delim_.empty(), "Delimiter must not be empty.");
+    }
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] iterator begin() const
+    {
+        return {this, record_.empty() ? nullptr : record_.data()};
+    }
+    [[nodiscard]] std::default_sentinel_t end() const
+    {
+        return {};
+    }
+
+    // the n'th (from 0) field or an empty view if there are not that many.
+    // Only scans as far as it needs to.
+
+    [[nodiscard]] std::string_view GetField(size_t n) const;
+
+    // ====================  MUTATORS      =======================================
+
+    // ====================  OPERATORS     =======================================
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // puts the field starting at 'next' in 'field' and moves 'next' past its delimiter.
+    // 'next' becomes nullptr after the last field. Returns false if there was no field.
+
+    bool NextField(const char *&next, std::string_view &field) const;
+
+    [[nodiscard]] const char *FindDelimiter(const char *first, const char *last) const;
+
+    // ====================  DATA MEMBERS  =======================================
+
+    std::string_view record_;
+    std::string_view delim_;
+    FieldQuoting quoting_ = FieldQuoting::e_None;
+
+}; // -----  end of class DelimitedFields  -----
+
+// =====================================================================================
+//        Class:  DelimitedLines
+//  Description:  A forward range over the lines of a buffer -- the in-memory analog of
+//                reading whole lines through the line_only_whitespace facet but without
+//                copying anything.  A trailing '\r' is dropped from each line and a final
+//                newline does not produce an extra empty line.  With e_RFC4180, newlines
+//                inside quoted fields don't end the line.
+// =====================================================================================
+
+class DelimitedLines : public std::ranges::view_interface<DelimitedLines>
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        iterator(const DelimitedLines *lines, const char *next) : lines_{lines}, next_{next}
+        {
+            at_end_ = !lines_->NextLine(next_, line_);
+        }
+
+        std::string_view operator*() const
+        {
+            return line_;
+        }
+        iterator &operator++()
+        {
+            at_end_ = !lines_->NextLine(next_, line_);
+            return *this;
+        }
+        iterator operator++(int)
+        {
+            auto temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        bool operator==(const iterator &rhs) const
+        {
+            return at_end_ == rhs.at_end_ && (at_end_ || line_.data() == rhs.line_.data());
+        }
+        bool operator==(std::default_sentinel_t) const
+        {
+            return at_end_;
+        }
+
+    private:
+        const DelimitedLines *lines_ = nullptr;
+        const char *next_ = nullptr;
+        std::string_view line_;
+        bool at_end_ = true;
+    };
+
+    // ====================  LIFECYCLE     =======================================
+
+    DelimitedLines() = default;
+    explicit DelimitedLines(std::string_view buffer, FieldQuoting quoting = FieldQuoting::e_None)
+        : buffer_{buffer}, quoting_{quoting}
+    {
+    }
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] iterator begin() const
+    {
+        return {this, buffer_.data()};
+    }
+    [[nodiscard]] std::default_sentinel_t end() const
+    {
+        return {};
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    // ====================  OPERATORS     =======================================
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    bool NextLine(const char *&next, std::string_view &line) const;
+
+    // ====================  DATA MEMBERS  =======================================
+
+    std::string_view buffer_;
+    FieldQuoting quoting_ = FieldQuoting::e_None;
+
+}; // -----  end of class DelimitedLines  -----
+
+// pick out fields by position. Missing fields come back empty.
+// e.g.  auto [date, close] = select_fields<0, 4>(DelimitedFields{line, ","});
+
+template <size_t N> inline std::string_view field(const DelimitedFields &fields)
+{
+    return fields.GetField(N);
+}
+
+template <size_t... Columns>
+inline std::array<std::string_view, sizeof...(Columns)> select_fields(const DelimitedFields &fields)
+    requires(sizeof...(Columns) > 0)
+{
+    constexpr std::array<size_t, sizeof...(Columns)> columns{Columns...};
+    constexpr size_t last_column = std::ranges::max(columns);
+
+    std::array<std::string_view, sizeof...(Columns)> results{};
+    size_t column = 0;
+    for (const auto item : fields)
+    {
+        for (size_t i = 0; i < columns.size(); ++i)
+        {
+            if (columns[i] == column)
+            {
+                results[i] = item;
+            }
+        }
+        if (column++ == last_column)
+        {
+            break;
+        }
+    }
+    return results;
+}
+
+// run time version: bit i of 'column_mask' selects field i. The selected fields are
+// written to 'results' in column order. Returns how many were found.
+
+size_t select_fields(const DelimitedFields &fields, uint64_t column_mask, std::span<std::string_view> results);
+
+// collapse the doubled quotes in a quoted field. This is the only part that allocates.
+
+std::string UnquoteField(std::string_view field);
+
+#endif /* DELIMITED_FIELDS_H_ */
@@ -0,0 +1,310 @@
+/* =====================================================================================
+ *
+ * Filename:  fixed_price.h
+ *
+ * Description:  Fixed point price type for hot paths where Decimal arithmetic is
+ *               too slow.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 21:10:38
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef FIXED_PRICE_H_
+#define FIXED_PRICE_H_
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "utilities.h"
+
+namespace fixed_price_detail
+{
+constexpr int64_t Pow10(int32_t n)
+{
+    int64_t result = 1;
+    for (; n > 0; --n)
+    {
+        result *= 10;
+    }
+    return result;
+}
+
+// integer division rounding half away from zero.
+
+constexpr int64_t RoundedDivide(int64_t value, int64_t divisor)
+{
+    const int64_t quotient = value / divisor;
+    const int64_t remainder = value % divisor;
+    if (2 * (remainder < 0 ? -remainder : remainder) >= divisor)
+    {
+        return quotient + (value < 0 ? -1 : 1);
+    }
+    return quotient;
+}
+} // namespace fixed_price_detail
+
+// =====================================================================================
+//        Class:  FixedPrice
+//  Description:  A price held as an integer count of 10^-Scale units.
+//                e.g. FixedPrice<4> holds 12.3456 as 123456.
+//                Addition, subtraction and comparison are plain integer operations.
+//                Conversions to and from Decimal are exact as long as the Decimal has
+//                no more than Scale fractional digits (and fits).  Extra digits are
+//                rounded half away from zero.
+// =====================================================================================
+
+template <int32_t Scale>
+    requires(Scale >= 0 && Scale <= 9)
+class FixedPrice
+{
+public:
+    static constexpr int32_t scale_ = Scale;
+    static constexpr int64_t scale_factor_ = fixed_price_detail::Pow10(Scale);
+
+    // ====================  LIFECYCLE     =======================================
+
+    constexpr FixedPrice() = default;
+
+    explicit FixedPrice(const Decimal &value)
+        : value_{static_cast<int64_t>(bd::round(value * Decimal{scale_factor_}))}
+    {
+    }
+
+    static constexpr FixedPrice FromRaw(int64_t raw_value)
+    {
+        FixedPrice result;
+        result.value_ = raw_value;
+        return result;
+    }
+
+    static constexpr FixedPrice FromInteger(int64_t whole_value)
+    {
+        return FromRaw(whole_value * scale_factor_);
+    }
+
+    // parse [-|+]digits[.digits] directly. empty if the text doesn't match or is too big.
+
+    static constexpr std::optional<FixedPrice> FromString(std::string_view text);
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] constexpr int64_t GetRaw() const
+    {
+        return value_;
+    }
+
+    [[nodiscard]] Decimal ToDecimal() const
+    {
+        return Decimal{value_, -Scale};
+    }
+
+    [[nodiscard]] constexpr double ToDouble() const
+    {
+        return static_cast<double>(value_) / static_cast<double>(scale_factor_);
+    }
+
+    // change the number of fractional digits we carry. Rounds if we lose digits.
+
+    template <int32_t NewScale> [[nodiscard]] constexpr FixedPrice<NewScale> Rescale() const
+    {
+        if constexpr (NewScale >= Scale)
+        {
+            return FixedPrice<NewScale>::FromRaw(value_ * fixed_price_detail::Pow10(NewScale - Scale));
+        }
+        else
+        {
+            return FixedPrice<NewScale>::FromRaw(
+                fixed_price_detail::RoundedDivide(value_, fixed_price_detail::Pow10(Scale - NewScale)));
+        }
+    }
+
+    // same idea as rescale_dpr: round to the given number of fractional digits
+    // but keep our scale.
+
+    [[nodiscard]] constexpr FixedPrice RoundToFractionalDigits(int32_t fractional_digits) const
+    {
+        if (fractional_digits >= Scale)
+        {
+            return *this;
+        }
+        const auto divisor = fixed_price_detail::Pow10(Scale - std::max(fractional_digits, 0));
+        return FromRaw(fixed_price_detail::RoundedDivide(value_, divisor) * divisor);
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    // ====================  OPERATORS     =======================================
+
+    constexpr auto operator<=>(const FixedPrice &rhs) const = default;
+
+    constexpr FixedPrice &operator+=(const FixedPrice &rhs)
+    {
+        value_ += rhs.value_;
+        return *this;
+    }
+    constexpr FixedPrice &operator-=(const FixedPrice &rhs)
+    {
+        value_ -= rhs.value_;
+        return *this;
+    }
+    constexpr FixedPrice &operator*=(int64_t rhs)
+    {
+        value_ *= rhs;
+        return *this;
+    }
+    constexpr FixedPrice operator-() const
+    {
+        return FromRaw(-value_);
+    }
+
+    friend constexpr FixedPrice operator+(FixedPrice lhs, const FixedPrice &rhs)
+    {
+        return lhs += rhs;
+    }
+    friend constexpr FixedPrice operator-(FixedPrice lhs, const FixedPrice &rhs)
+    {
+        return lhs -= rhs;
+    }
+    friend constexpr FixedPrice operator*(FixedPrice lhs, int64_t rhs)
+    {
+        return lhs *= rhs;
+    }
+    friend constexpr FixedPrice operator*(int64_t lhs, FixedPrice rhs)
+    {
+        return rhs *= lhs;
+    }
+
+    // how many whole 'rhs' fit in us. e.g. number of boxes in a price range.
+
+    friend constexpr int64_t operator/(const FixedPrice &lhs, const FixedPrice &rhs)
+    {
+        return lhs.value_ / rhs.value_;
+    }
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+    int64_t value_ = 0;
+
+}; // -----  end of class FixedPrice  -----
+
+template <int32_t Scale>
+    requires(Scale >= 0 && Scale <= 9)
+constexpr std::optional<FixedPrice<Scale>> FixedPrice<Scale>::FromString(std::string_view text)
+{
+    constexpr int64_t max_value = std::numeric_limits<int64_t>::max();
+
+    bool negative = false;
+    if (!text.empty() && (text[0] == '-' || text[0] == '+'))
+    {
+        negative = text[0] == '-';
+        text.remove_prefix(1);
+    }
+    if (text.empty())
+    {
+        return std::nullopt;
+    }
+
+    int64_t value = 0;
+    int32_t fractional_digits = 0;
+    bool seen_dot = false;
+    bool seen_digit = false;
+    int32_t round_digit = -1; // first digit past our scale, if any
+
+    for (const char c : text)
+    {
+        if (c == '.' && !seen_dot)
+        {
+            seen_dot = true;
+            continue;
+        }
+        if (c < '0' || c > '9')
+        {
+            return std::nullopt;
+        }
+        seen_digit = true;
+        if (seen_dot && fractional_digits == Scale)
+        {
+            if (round_digit < 0)
+            {
+                round_digit = c - '0';
+            }
+            continue;
+        }
+        const int32_t digit = c - '0';
+        if (value > (max_value - digit) / 10)
+        {
+            return std::nullopt;
+        }
+        value = value * 10 + digit;
+        fractional_digits += seen_dot ? 1 : 0;
+    }
+    if (!seen_digit)
+    {
+        return std::nullopt;
+    }
+    for (; fractional_digits < Scale; ++fractional_digits)
+    {
+        if (value > max_value / 10)
+        {
+            return std::nullopt;
+        }
+        value *= 10;
+    }
+    if (round_digit >= 5)
+    {
+        if (value == max_value)
+        {
+            return std::nullopt;
+        }
+        ++value;
+    }
+    return FromRaw(negative ? -value : value);
+}
+
+// custom formatter for FixedPrice. Always shows all Scale fractional digits.
+
+template <int32_t Scale> struct std::formatter<FixedPrice<Scale>> : std::formatter<std::string>
+{
+    // parse is inherited from formatter<string>.
+    auto format(const FixedPrice<Scale> &price, std::format_context &ctx) const
+    {
+        const auto raw = price.GetRaw();
+        const uint64_t magnitude = raw < 0 ? 0 - static_cast<uint64_t>(raw) : static_cast<uint64_t>(raw);
+        const auto factor = static_cast<uint64_t>(FixedPrice<Scale>::scale_factor_);
+        std::string s;
+        if constexpr (Scale == 0)
+        {
+            std::format_to(std::back_inserter(s), "{}{}", raw < 0 ? "-" : "", magnitude);
+        }
+        else
+        {
+            std::format_to(std::back_inserter(s), "{}{}.{:0{}}", raw < 0 ? "-" : "", magnitude / factor,
+                           magnitude % factor, Scale);
+        }
+        return formatter<std::string>::format(s, ctx);
+    }
+};
+
+#endif /* FIXED_PRICE_H_ */
@@ -0,0 +1,218 @@
+/* =====================================================================================
+ *
+ * Filename:  instrumentation.h
+ *
+ * Description:  Lightweight, compile time switchable timers, counters and histograms
+ *               for seeing where time goes inside library calls.
+ *
+ *               Build with COMMON_UTILITIES_INSTRUMENTATION defined to turn it on
+ *               (the CMake option COMMON_UTILITIES_ENABLE_INSTRUMENTATION does that).
+ *               Otherwise the INSTRUMENT_... macros expand to nothing.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 13:20:46
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef INSTRUMENTATION_H_
+#define INSTRUMENTATION_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(COMMON_UTILITIES_INSTRUMENTATION_RDTSC) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+#include <json/json.h>
+
+namespace instrumentation
+{
+// Timers record elapsed nanoseconds and, optionally, an amount of work done (bytes,
+// rows, ...) so we can report a rate.  Counters just add up amounts.  Histograms
+// record the distribution of the values they're given.
+
+enum class MetricKind : int32_t
+{
+    e_Timer,
+    e_Counter,
+    e_Histogram
+};
+
+using MetricID = uint32_t;
+
+// histogram bucket i counts values v with bit_width(v) == i, i.e. [2^(i-1), 2^i), so
+// bucket 0 is just 0.  The last bucket also takes everything bigger.  Dumps give each
+// bucket's inclusive upper bound, 2^i - 1.
+
+inline constexpr size_t HistogramBuckets = 64;
+
+// metrics are registered once (the macros keep the ID in a function level static).
+// registering an existing name returns its ID.  Throws if there are already 256.
+
+MetricID RegisterMetric(std::string_view name, MetricKind kind, std::string_view work_unit = {});
+
+// add one observation to this thread's copy of the metric.
+
+void Record(MetricID id, uint64_t value, uint64_t work = 0);
+
+// timestamps for timers. steady_clock by default.  With COMMON_UTILITIES_INSTRUMENTATION_RDTSC
+// on x86 we read the TSC instead which is cheaper; ticks are converted to nanoseconds
+// when recorded using a one time calibration against steady_clock.
+
+inline uint64_t ReadClock()
+{
+#if defined(COMMON_UTILITIES_INSTRUMENTATION_RDTSC) && (defined(__x86_64__) || defined(__i386__))
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+uint64_t ClockTicksToNanoseconds(uint64_t ticks);
+
+// =====================================================================================
+//        Class:  ScopedTimer
+//  Description:  Records the time from construction to destruction.
+// =====================================================================================
+
+class ScopedTimer
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    explicit ScopedTimer(MetricID id) : id_{id}, start_{ReadClock()}
+    {
+    }
+    ScopedTimer(const ScopedTimer &rhs) = delete;
+
+    ~ScopedTimer()
+    {
+        Record(id_, ClockTicksToNanoseconds(ReadClock() - start_), work_);
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    void SetWork(uint64_t work)
+    {
+        work_ = work;
+    }
+
+    // ====================  OPERATORS     =======================================
+
+    ScopedTimer &operator=(const ScopedTimer &rhs) = delete;
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+    MetricID id_;
+    uint64_t start_;
+    uint64_t work_ = 0;
+
+}; // -----  end of class ScopedTimer  -----
+
+// all threads' data for one metric combined, including threads which have exited.
+
+struct MetricSnapshot
+{
+    std::string name_;
+    MetricKind kind_ = MetricKind::e_Counter;
+    std::string work_unit_;
+    uint64_t count_ = 0;
+    uint64_t total_ = 0; // nanoseconds for timers
+    uint64_t min_ = 0;
+    uint64_t max_ = 0;
+    uint64_t work_ = 0;
+    std::array<uint64_t, HistogramBuckets> buckets_{};
+
+    // work_ per second of timer total_. 0 if not a timer or no time recorded.
+
+    [[nodiscard]] double WorkPerSecond() const
+    {
+        if (kind_ != MetricKind::e_Timer || total_ == 0)
+        {
+            return 0.0;
+        }
+        return static_cast<double>(work_) * 1e9 / static_cast<double>(total_);
+    }
+};
+
+// these are safe to call while other threads are recording. When instrumentation
+// is compiled out nothing registers a metric so TakeSnapshot returns an empty list.
+
+[[nodiscard]] std::vector<MetricSnapshot> TakeSnapshot();
+void ResetMetrics();
+
+[[nodiscard]] Json::Value SnapshotToJSON(const std::vector<MetricSnapshot> &snapshot);
+
+// Prometheus text exposition format. Metric names are prefixed with 'prefix'.
+
+[[nodiscard]] std::string SnapshotToPrometheus(const std::vector<MetricSnapshot> &snapshot,
+                                               std::string_view prefix = "common_utilities_");
+
+} // namespace instrumentation
+
+#define INSTRUMENT_CONCAT_(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_(a, b)
+
+#if defined(COMMON_UTILITIES_INSTRUMENTATION)
+
+// time the rest of the enclosing scope. 'var' names the timer so work can be added:
+//      INSTRUMENT_TIMER(timer, "load_data_file", "bytes");
+//      ...
+//      INSTRUMENT_TIMER_WORK(timer, file_content.size());
+
+#define INSTRUMENT_TIMER(var, name, work_unit)                                                                     \
+    static const ::instrumentation::MetricID INSTRUMENT_CONCAT(var, _metric_id) =                                  \
+        ::instrumentation::RegisterMetric(name, ::instrumentation::MetricKind::e_Timer, work_unit);                 \
+    ::instrumentation::ScopedTimer var                                                                             \
+    {                                                                                                              \
+        INSTRUMENT_CONCAT(var, _metric_id)                                                                         \
+    }
+
+#define INSTRUMENT_TIMER_WORK(var, amount) var.SetWork(static_cast<uint64_t>(amount))
+
+#define INSTRUMENT_COUNT(name, amount)                                                                             \
+    do                                                                                                             \
+    {                                                                                                              \
+        static const ::instrumentation::MetricID instrument_metric_id =                                            \
+            ::instrumentation::RegisterMetric(name, ::instrumentation::MetricKind::e_Counter);                      \
+        ::instrumentation::Record(instrument_metric_id, static_cast<uint64_t>(amount));                           \
+    } while (false)
+
+#define INSTRUMENT_HISTOGRAM(name, value)                                                                          \
+    do                                                                                                             \
+    {                                                                                                              \
+        static const ::instrumentation::MetricID instrument_metric_id =                                            \
+            ::instrumentation::RegisterMetric(name, ::instrumentation::MetricKind::e_Histogram);                    \
+        ::instrumentation::Record(instrument_metric_id, static_cast<uint64_t>(value));                            \
+    } while (false)
+
+#else
+
+#define INSTRUMENT_TIMER(var, name, work_unit) static_cast<void>(0)
+#define INSTRUMENT_TIMER_WORK(var, amount) static_cast<void>(0)
+#define INSTRUMENT_COUNT(name, amount) static_cast<void>(0)
+#define INSTRUMENT_HISTOGRAM(name, value) static_cast<void>(0)
+
+#endif
+
+#endif /* INSTRUMENTATION_H_ */
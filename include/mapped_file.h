@@ -0,0 +1,105 @@
+/* =====================================================================================
+ *
+ * Filename:  mapped_file.h
+ *
+ * Description:  RAII wrapper for a read-only memory mapped file.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 11:02:17
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef MAPPED_FILE_H_
+#define MAPPED_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+
+namespace fs = std::filesystem;
+
+// how we expect to read the mapped data. This is passed on to the kernel as a hint.
+
+enum class MappedFileAccess : int32_t
+{
+    e_Sequential,
+    e_SequentialHugePages,
+    e_Random
+};
+
+// =====================================================================================
+//        Class:  MappedFile
+//  Description:  Maps an entire file read-only so it can be used in place without
+//                copying it into a string first.
+// =====================================================================================
+
+class MappedFile
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    MappedFile() = default;
+    explicit MappedFile(const fs::path &file_name, MappedFileAccess access = MappedFileAccess::e_Sequential);
+
+    MappedFile(const MappedFile &rhs) = delete;
+    MappedFile(MappedFile &&rhs) noexcept;
+
+    ~MappedFile();
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] const char *data() const
+    {
+        return data_;
+    }
+    [[nodiscard]] size_t size() const
+    {
+        return size_;
+    }
+    [[nodiscard]] bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] std::string_view AsStringView() const
+    {
+        return {data_, size_};
+    }
+    [[nodiscard]] std::span<const std::byte> AsBytes() const
+    {
+        return {reinterpret_cast<const std::byte *>(data_), size_};
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    // ====================  OPERATORS     =======================================
+
+    MappedFile &operator=(const MappedFile &rhs) = delete;
+    MappedFile &operator=(MappedFile &&rhs) noexcept;
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    void Unmap();
+
+    // ====================  DATA MEMBERS  =======================================
+
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+
+}; // -----  end of class MappedFile  -----
+
+#endif /* MAPPED_FILE_H_ */
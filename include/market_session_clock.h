@@ -0,0 +1,105 @@
+/* =====================================================================================
+ *
+ * Filename:  market_session_clock.h
+ *
+ * Description:  Cheap, repeatable US market status checks for streaming code.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 17:05:33
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef MARKET_SESSION_CLOCK_H_
+#define MARKET_SESSION_CLOCK_H_
+
+#include <chrono>
+#include <string_view>
+
+#include "trading_calendar.h"
+#include "utilities.h"
+
+// =====================================================================================
+//        Class:  MarketSessionClock
+//  Description:  Resolves time zones once and caches the current US trading day's
+//                open and close instants.  Those are only recomputed when the given
+//                time moves to a different day in New York.  Otherwise a status check
+//                is a couple of comparisons.
+// =====================================================================================
+
+class MarketSessionClock
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    explicit MarketSessionClock(std::string_view local_time_zone_name,
+                                const TradingCalendar &calendar = GetUS_TradingCalendar());
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] const std::chrono::time_zone *GetLocalTimeZone() const
+    {
+        return local_zone_;
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    // these update the cached session when we cross into a new day.
+
+    US_MarketStatus GetStatus(std::chrono::sys_seconds now);
+    US_MarketStatus GetStatus(std::chrono::local_seconds local_now)
+    {
+        return GetStatus(local_zone_->to_sys(local_now));
+    }
+
+    // zero if the market is currently open.
+
+    std::chrono::seconds SecondsUntilOpen(std::chrono::sys_seconds now);
+
+    // zero if the market is not currently open.
+
+    std::chrono::seconds SecondsUntilClose(std::chrono::sys_seconds now);
+
+    // ====================  OPERATORS     =======================================
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    void UpdateSession(std::chrono::sys_seconds now)
+    {
+        if (now < day_begin_ || now >= day_end_)
+        {
+            StartNewDay(now);
+        }
+    }
+
+    void StartNewDay(std::chrono::sys_seconds now);
+
+    // ====================  DATA MEMBERS  =======================================
+
+    const std::chrono::time_zone *local_zone_;
+    const TradingCalendar *calendar_;
+
+    // the New York day we have cached, as instants.
+
+    std::chrono::sys_seconds day_begin_ = std::chrono::sys_seconds::max();
+    std::chrono::sys_seconds day_end_ = std::chrono::sys_seconds::min();
+
+    std::chrono::sys_seconds market_open_;
+    std::chrono::sys_seconds market_close_;
+    std::chrono::sys_seconds next_market_open_;
+    bool is_trading_day_ = false;
+
+}; // -----  end of class MarketSessionClock  -----
+
+#endif /* MARKET_SESSION_CLOCK_H_ */
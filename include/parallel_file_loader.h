@@ -0,0 +1,70 @@
+/* =====================================================================================
+ *
+ * Filename:  parallel_file_loader.h
+ *
+ * Description:  Load and parse many per-symbol JSON chart files at once.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 21:48:05
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef PARALLEL_FILE_LOADER_H_
+#define PARALLEL_FILE_LOADER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string>
+
+#include <json/json.h>
+
+namespace fs = std::filesystem;
+
+// one loaded file. If anything went wrong, error_ says what and data_ is null.
+
+struct LoadedJSONFile
+{
+    fs::path file_name_;
+    Json::Value data_;
+    std::string error_;
+
+    [[nodiscard]] bool IsOK() const
+    {
+        return error_.empty();
+    }
+};
+
+struct ParallelLoadOptions
+{
+    // 0 means use std::thread::hardware_concurrency()
+    uint32_t thread_count_ = 0;
+
+    // most parsed files allowed to sit waiting for the caller. 0 means 2 per thread.
+    // This is what bounds the memory in use.
+    uint32_t max_files_in_flight_ = 0;
+};
+
+using LoadedJSONFileHandler = std::function<void(LoadedJSONFile &&loaded_file)>;
+
+// ===  FUNCTION  ======================================================================
+//         Name:  LoadJSONFilesInParallel
+//  Description:  reads and parses each file on a pool of worker threads.  'on_loaded'
+//                is called on the calling thread, once per file, in the order the files
+//                finish (not the order given).  Errors are reported per file through
+//                LoadedJSONFile::error_ rather than thrown.
+//                Returns the number of files loaded without error.
+// =====================================================================================
+
+size_t LoadJSONFilesInParallel(std::span<const fs::path> file_names, const LoadedJSONFileHandler &on_loaded,
+                               const ParallelLoadOptions &options = {});
+
+#endif /* PARALLEL_FILE_LOADER_H_ */
@@ -0,0 +1,147 @@
+/* =====================================================================================
+ *
+ * Filename:  price_bar_builder.h
+ *
+ * Description:  Build open/high/low/close time bars from streamed prices as the
+ *               ticks arrive instead of rescanning the collected prices.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 15:02:37
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef PRICE_BAR_BUILDER_H_
+#define PRICE_BAR_BUILDER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "symbol_registry.h"
+#include "utilities.h"
+
+// one time bar. start_seconds_ is a unix time like StreamedPrices timestamps.
+
+struct PriceBar
+{
+    int64_t start_seconds_{0};
+    int64_t width_seconds_{0};
+    double open_{0.};
+    double high_{0.};
+    double low_{0.};
+    double close_{0.};
+    uint32_t tick_count_{0};
+};
+
+using PriceBarHandler = std::function<void(SymbolID id, const PriceBar &bar)>;
+
+// =====================================================================================
+//        Class:  PriceBarBuilder
+//  Description:  Keeps the bar in progress for each symbol and each bar width and
+//                updates all of them with each tick, so a tick costs O(number of
+//                widths).  Bars are aligned to the US market open
+//                (GetUS_MarketOpenTime) of the tick's day in New York, so a 5 minute
+//                bar covers 9:30 - 9:35, 9:35 - 9:40 and so on.
+//
+//                When a tick falls past the end of a symbol's current bar, that bar is
+//                complete and is passed to the handler.  Periods with no ticks produce
+//                no bars.  A late tick (earlier than the current bar) is folded into
+//                the current bar.
+//
+//                Not thread safe.  Use one builder per consumer thread, e.g. fed from
+//                ConcurrentTickIngestor::DrainTicks.  The handler must not call back into
+//                the builder.
+// =====================================================================================
+
+class PriceBarBuilder
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    PriceBarBuilder(std::span<const std::chrono::seconds> bar_widths, PriceBarHandler on_bar_completed);
+    PriceBarBuilder(std::initializer_list<std::chrono::seconds> bar_widths, PriceBarHandler on_bar_completed)
+        : PriceBarBuilder(std::span<const std::chrono::seconds>{bar_widths.begin(), bar_widths.size()},
+                          std::move(on_bar_completed))
+    {
+    }
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] std::span<const int64_t> GetBarWidths() const
+    {
+        return bar_widths_;
+    }
+
+    // the bar currently being built for the symbol and the 'which_width' entry of the
+    // bar widths. nullptr if there isn't one.
+
+    [[nodiscard]] const PriceBar *GetCurrentBar(SymbolID id, size_t which_width) const;
+
+    // ====================  MUTATORS      =======================================
+
+    void AddTick(SymbolID id, int64_t timestamp_seconds, double price);
+
+    // to catch up from already collected prices, e.g. a StreamedPrices or the view of
+    // a StreamedPricesRing.
+
+    void AddTicks(SymbolID id, std::span<const int64_t> timestamp_seconds, std::span<const double> prices);
+
+    // pass the bars in progress to the handler (as at the close) and start over.
+
+    void Flush(SymbolID id);
+    void FlushAll();
+
+    // ====================  OPERATORS     =======================================
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // ticks nearly always arrive on the same day as the last one so we cache that
+    // day's open and only look it up again when the day changes.
+
+    int64_t GetMarketOpen(int64_t timestamp_seconds)
+    {
+        if (timestamp_seconds < day_begin_ || timestamp_seconds >= day_end_)
+        {
+            StartNewDay(timestamp_seconds);
+        }
+        return market_open_;
+    }
+
+    void StartNewDay(int64_t timestamp_seconds);
+
+    // ====================  DATA MEMBERS  =======================================
+
+    std::vector<int64_t> bar_widths_;
+    PriceBarHandler on_bar_completed_;
+
+    // bar_widths_.size() entries per symbol, by SymbolID. tick_count_ == 0 means no
+    // bar in progress.
+
+    std::vector<PriceBar> bars_;
+
+    // the New York day we have cached, as unix times.
+
+    int64_t day_begin_ = 0;
+    int64_t day_end_ = 0;
+    int64_t market_open_ = 0;
+
+}; // -----  end of class PriceBarBuilder  -----
+
+#endif /* PRICE_BAR_BUILDER_H_ */
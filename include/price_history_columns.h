@@ -0,0 +1,171 @@
+/* =====================================================================================
+ *
+ * Filename:  price_history_columns.h
+ *
+ * Description:  Column oriented (struct of arrays) storage for a single symbol's
+ *               price history.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 14:40:12
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef PRICE_HISTORY_COLUMNS_H_
+#define PRICE_HISTORY_COLUMNS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utilities.h"
+
+// a lightweight, by value, view of one row of a PriceHistoryColumns.
+// It can be formatted just like a StockDataRecord or converted to one.
+
+struct PriceHistoryRow
+{
+    std::chrono::sys_days date_;
+    std::string_view symbol_;
+    Decimal open_;
+    Decimal high_;
+    Decimal low_;
+    Decimal close_;
+
+    // the date is given in YYYY-MM-DD form.
+
+    explicit operator StockDataRecord() const
+    {
+        return {std::format("{:%F}", date_), std::string{symbol_}, open_, high_, low_, close_};
+    }
+};
+
+// =====================================================================================
+//        Class:  PriceHistoryColumns
+//  Description:  Holds each field of a price history in its own contiguous column with
+//                the symbol stored just once.  Good for analytics that scan a single
+//                column at a time.
+// =====================================================================================
+
+class PriceHistoryColumns
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    PriceHistoryColumns() = default;
+    explicit PriceHistoryColumns(std::string symbol) : symbol_{std::move(symbol)}
+    {
+    }
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] const std::string &GetSymbol() const
+    {
+        return symbol_;
+    }
+    [[nodiscard]] size_t size() const
+    {
+        return date_.size();
+    }
+    [[nodiscard]] bool empty() const
+    {
+        return date_.empty();
+    }
+
+    [[nodiscard]] std::span<const std::chrono::sys_days> GetDates() const
+    {
+        return date_;
+    }
+    [[nodiscard]] std::span<const Decimal> GetOpens() const
+    {
+        return open_;
+    }
+    [[nodiscard]] std::span<const Decimal> GetHighs() const
+    {
+        return high_;
+    }
+    [[nodiscard]] std::span<const Decimal> GetLows() const
+    {
+        return low_;
+    }
+    [[nodiscard]] std::span<const Decimal> GetCloses() const
+    {
+        return close_;
+    }
+
+    // a lazy, row at a time view of the columns.
+
+    [[nodiscard]] auto Rows() const
+    {
+        return std::views::iota(size_t{0}, size()) | std::views::transform([this](size_t i) { return (*this)[i]; });
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    void reserve(size_t how_many);
+
+    void AddRow(std::chrono::sys_days date, Decimal open, Decimal high, Decimal low, Decimal close);
+
+    // ====================  OPERATORS     =======================================
+
+    PriceHistoryRow operator[](size_t i) const
+    {
+        return {date_[i], symbol_, open_[i], high_[i], low_[i], close_[i]};
+    }
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+    std::string symbol_;
+
+    std::vector<std::chrono::sys_days> date_;
+    std::vector<Decimal> open_;
+    std::vector<Decimal> high_;
+    std::vector<Decimal> low_;
+    std::vector<Decimal> close_;
+
+}; // -----  end of class PriceHistoryColumns  -----
+
+// bridge between Tiingo price history data and columnar price history.
+// These mirror ConvertJSONPriceHistory and ParseJSONPriceHistory.
+
+PriceHistoryColumns ConvertJSONPriceHistoryToColumns(const std::string &symbol, const Json::Value &the_data,
+                                                     uint32_t how_many_days, UseAdjusted use_adjusted);
+
+PriceHistoryColumns ParseJSONPriceHistoryToColumns(const std::string &symbol, std::string_view json_text,
+                                                   uint32_t how_many_days, UseAdjusted use_adjusted);
+
+// custom formatter for PriceHistoryRow. Same layout as StockDataRecord
+
+template <>
+struct std::formatter<PriceHistoryRow> : std::formatter<std::string>
+{
+    // parse is inherited from formatter<string>.
+    auto format(const PriceHistoryRow &row, std::format_context &ctx) const
+    {
+        std::string record;
+        std::format_to(std::back_inserter(record), "{:%F}, {}, {}, {}, {}, {}", row.date_, row.symbol_, row.open_,
+                       row.high_, row.low_, row.close_);
+        return formatter<std::string>::format(record, ctx);
+    }
+};
+
+#endif /* PRICE_HISTORY_COLUMNS_H_ */
@@ -0,0 +1,102 @@
+/* =====================================================================================
+ *
+ * Filename:  price_history_reader.h
+ *
+ * Description:  Pull style reader for Tiingo price history JSON which does not build
+ *               a Json::Value DOM.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 13:20:45
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef PRICE_HISTORY_READER_H_
+#define PRICE_HISTORY_READER_H_
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "utilities.h"
+
+// the fields of one row of price history we care about. These refer directly into
+// the JSON text so they are only good as long as the text is.
+// an empty field means it was not found in the row.
+
+struct PriceHistoryJSONRow
+{
+    std::string_view date_;
+    std::string_view open_;
+    std::string_view high_;
+    std::string_view low_;
+    std::string_view close_;
+};
+
+// =====================================================================================
+//        Class:  PriceHistoryJSONReader
+//  Description:  Walks a JSON array of price history objects one row at a time.
+//                Only the date and the (adjusted or unadjusted) prices are picked out,
+//                everything else is skipped over.  Nothing is allocated.
+// =====================================================================================
+
+class PriceHistoryJSONReader
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    PriceHistoryJSONReader(std::string_view json_text, UseAdjusted use_adjusted);
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] size_t GetRowsRead() const
+    {
+        return rows_read_;
+    }
+
+    // convert one of the price fields of the current row. Throws if it is missing or invalid.
+
+    [[nodiscard]] Decimal FieldToDecimal(std::string_view field) const;
+
+    // ====================  MUTATORS      =======================================
+
+    // returns false when there are no more rows.
+
+    bool NextRow(PriceHistoryJSONRow &row);
+
+    // ====================  OPERATORS     =======================================
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    void SkipWhitespace();
+    void Expect(char c);
+    std::string_view ReadString();
+    std::string_view ReadScalar();
+    void SkipValue();
+
+    [[noreturn]] void ThrowParseError(std::string_view problem) const;
+
+    // ====================  DATA MEMBERS  =======================================
+
+    std::string_view json_text_;
+    size_t pos_ = 0;
+    size_t rows_read_ = 0;
+    bool finished_ = false;
+
+    // open, high, low, close
+    std::array<std::string_view, 4> price_keys_;
+
+}; // -----  end of class PriceHistoryJSONReader  -----
+
+#endif /* PRICE_HISTORY_READER_H_ */
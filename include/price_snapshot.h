@@ -0,0 +1,226 @@
+/* =====================================================================================
+ *
+ * Filename:  price_snapshot.h
+ *
+ * Description:  Versioned binary columnar file format for price histories.
+ *               Written once from parsed JSON, then reloaded by mapping the file
+ *               instead of parsing it again.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 22:31:12
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef PRICE_SNAPSHOT_H_
+#define PRICE_SNAPSHOT_H_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "mapped_file.h"
+#include "price_history_columns.h"
+#include "symbol_registry.h"
+#include "utilities.h"
+
+// File layout (all in native byte order which is checked on load):
+//
+//   PriceSnapshotHeader
+//   PriceSnapshotColumnEntry[column_count_]
+//   each column, starting on a 64 byte boundary
+//
+// Columns hold the in-memory representation of their element type so the reader can
+// hand out spans directly into the mapping.  Symbols are kept once, as a table of
+// offsets into a block of characters.  Any change to the layout or to the element
+// types must bump PriceSnapshotVersion.
+
+inline constexpr std::array<char, 8> PriceSnapshotMagic{'P', 'F', 'S', 'N', 'A', 'P', '\0', '\0'};
+inline constexpr uint32_t PriceSnapshotVersion = 1;
+inline constexpr uint32_t PriceSnapshotByteOrderMark = 0x01020304;
+inline constexpr size_t PriceSnapshotColumnAlignment = 64;
+
+enum class PriceSnapshotKind : uint32_t
+{
+    e_StockData = 1,           // PriceHistoryColumns / StockDataRecord
+    e_DateClose = 2,           // DateCloseRecord
+    e_MultiSymbolDateClose = 3 // MultiSymbolDateCloseRecord
+};
+
+enum class PriceSnapshotColumn : uint32_t
+{
+    e_SymbolOffsets = 1, // uint32_t, symbol_count + 1 entries
+    e_SymbolChars,       // char
+    e_SymbolID,          // SymbolID, one per row
+    e_Date,              // std::chrono::sys_days
+    e_TimePoint,         // std::chrono::utc_clock::time_point
+    e_Open,              // Decimal
+    e_High,              // Decimal
+    e_Low,               // Decimal
+    e_Close              // Decimal
+};
+
+struct PriceSnapshotHeader
+{
+    std::array<char, 8> magic_;
+    uint32_t version_;
+    uint32_t byte_order_mark_;
+    PriceSnapshotKind kind_;
+    uint32_t column_count_;
+    uint64_t row_count_;
+    uint32_t symbol_count_;
+    uint32_t reserved_;
+};
+
+struct PriceSnapshotColumnEntry
+{
+    PriceSnapshotColumn column_;
+    uint32_t element_size_;
+    uint64_t offset_;
+    uint64_t element_count_;
+};
+
+static_assert(std::is_trivially_copyable_v<Decimal> && std::is_trivially_copyable_v<std::chrono::sys_days> &&
+                  std::is_trivially_copyable_v<std::chrono::utc_clock::time_point>,
+              "snapshot columns are stored as raw bytes");
+
+// ===  FUNCTION  ======================================================================
+//         Name:  WritePriceSnapshot
+//  Description:  one overload per kind of price data.  The file is replaced if it
+//                exists.  StockDataRecords must all be for the same symbol and are
+//                stored like PriceHistoryColumns: only the date part (the first 10
+//                characters) of date_ is kept, so any time of day, such as the
+//                'T00:00:00.000Z' in Tiingo data, is dropped.
+// =====================================================================================
+
+void WritePriceSnapshot(const fs::path &file_name, const PriceHistoryColumns &history);
+void WritePriceSnapshot(const fs::path &file_name, std::span<const StockDataRecord> history);
+void WritePriceSnapshot(const fs::path &file_name, const std::string &symbol,
+                        std::span<const DateCloseRecord> history);
+void WritePriceSnapshot(const fs::path &file_name, std::span<const MultiSymbolDateCloseRecord> history);
+
+// =====================================================================================
+//        Class:  PriceSnapshotReader
+//  Description:  Maps a snapshot file and gives zero-copy access to its columns.
+//                The spans are only good as long as the reader is alive.
+//                The constructor throws unless every column the file's kind needs
+//                has exactly one value per row.  Columns the kind doesn't have come
+//                back empty.
+// =====================================================================================
+
+class PriceSnapshotReader
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    explicit PriceSnapshotReader(const fs::path &file_name);
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] PriceSnapshotKind GetKind() const
+    {
+        return header_.kind_;
+    }
+    [[nodiscard]] size_t size() const
+    {
+        return static_cast<size_t>(header_.row_count_);
+    }
+    [[nodiscard]] bool empty() const
+    {
+        return header_.row_count_ == 0;
+    }
+
+    [[nodiscard]] size_t GetSymbolCount() const
+    {
+        return header_.symbol_count_;
+    }
+    [[nodiscard]] std::string_view GetSymbol(SymbolID id) const
+    {
+        return {symbol_chars_.data() + symbol_offsets_[id], symbol_offsets_[id + 1] - symbol_offsets_[id]};
+    }
+
+    [[nodiscard]] std::span<const SymbolID> GetSymbolIDs() const
+    {
+        return symbol_ids_;
+    }
+    [[nodiscard]] std::span<const std::chrono::sys_days> GetDates() const
+    {
+        return dates_;
+    }
+    [[nodiscard]] std::span<const std::chrono::utc_clock::time_point> GetTimePoints() const
+    {
+        return time_points_;
+    }
+    [[nodiscard]] std::span<const Decimal> GetOpens() const
+    {
+        return opens_;
+    }
+    [[nodiscard]] std::span<const Decimal> GetHighs() const
+    {
+        return highs_;
+    }
+    [[nodiscard]] std::span<const Decimal> GetLows() const
+    {
+        return lows_;
+    }
+    [[nodiscard]] std::span<const Decimal> GetCloses() const
+    {
+        return closes_;
+    }
+
+    // copy out into the usual in-memory forms.  Each throws if the file holds a different
+    // kind.  ToStockDataRecords gives date_ as YYYY-MM-DD (see WritePriceSnapshot) so it
+    // is not always the original string.
+
+    [[nodiscard]] PriceHistoryColumns ToPriceHistoryColumns() const;
+    [[nodiscard]] std::vector<StockDataRecord> ToStockDataRecords() const;
+    [[nodiscard]] std::vector<DateCloseRecord> ToDateCloseRecords() const;
+    [[nodiscard]] std::vector<MultiSymbolDateCloseRecord> ToMultiSymbolDateCloseRecords() const;
+
+    // ====================  MUTATORS      =======================================
+
+    // ====================  OPERATORS     =======================================
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    template <typename T> std::span<const T> FindColumn(PriceSnapshotColumn which) const;
+
+    void RequireKind(PriceSnapshotKind kind) const;
+
+    // ====================  DATA MEMBERS  =======================================
+
+    MappedFile snapshot_file_;
+    PriceSnapshotHeader header_{};
+    std::span<const PriceSnapshotColumnEntry> columns_;
+
+    std::span<const uint32_t> symbol_offsets_;
+    std::span<const char> symbol_chars_;
+    std::span<const SymbolID> symbol_ids_;
+    std::span<const std::chrono::sys_days> dates_;
+    std::span<const std::chrono::utc_clock::time_point> time_points_;
+    std::span<const Decimal> opens_;
+    std::span<const Decimal> highs_;
+    std::span<const Decimal> lows_;
+    std::span<const Decimal> closes_;
+
+}; // -----  end of class PriceSnapshotReader  -----
+
+#endif /* PRICE_SNAPSHOT_H_ */
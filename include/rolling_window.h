@@ -0,0 +1,107 @@
+/* =====================================================================================
+ *
+ * Filename:  rolling_window.h
+ *
+ * Description:  Moving window statistics (sum, mean, min, max, variance) and returns
+ *               over contiguous columns of prices.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 16:04:51
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef ROLLING_WINDOW_H_
+#define ROLLING_WINDOW_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "fixed_price.h"
+#include "price_history_columns.h"
+#include "utilities.h"
+
+// All the rolling functions work the same way: given n values and a window of w,
+// they return n - w + 1 results (none if n < w) where result[i] covers
+// values[i] ... values[i + w - 1].  Each step costs O(1) (amortized for min/max)
+// no matter how wide the window is.
+//
+// Decimal arithmetic is slow so the kernels work on double columns, or on the raw
+// int64_t values of FixedPrice columns where sums are exact.  Use the Extract...
+// functions below to get a column from our usual price containers.
+
+// --- getting a column of closes ---
+
+std::vector<double> ExtractCloses(std::span<const DateCloseRecord> records);
+std::vector<double> ExtractCloses(std::span<const StockDataRecord> records);
+std::vector<double> ExtractCloses(const PriceHistoryColumns &prices);
+
+template <int32_t Scale> std::vector<int64_t> ExtractRawValues(std::span<const FixedPrice<Scale>> prices)
+{
+    std::vector<int64_t> result;
+    result.reserve(prices.size());
+    for (const auto &price : prices)
+    {
+        result.push_back(price.GetRaw());
+    }
+    return result;
+}
+
+// --- the kernels ---
+
+// sums are periodically recomputed from scratch so floating point error from
+// adding and subtracting does not build up over long series.
+
+std::vector<double> RollingSum(std::span<const double> values, size_t window);
+std::vector<int64_t> RollingSum(std::span<const int64_t> values, size_t window);
+
+std::vector<double> RollingMean(std::span<const double> values, size_t window);
+
+// these use a monotonic deque: each value is pushed and popped at most once.
+
+std::vector<double> RollingMin(std::span<const double> values, size_t window);
+std::vector<double> RollingMax(std::span<const double> values, size_t window);
+std::vector<int64_t> RollingMin(std::span<const int64_t> values, size_t window);
+std::vector<int64_t> RollingMax(std::span<const int64_t> values, size_t window);
+
+// sample (n - 1) variance using Welford's update for a sliding window.
+// A window of 1 gives all zeros.
+
+std::vector<double> RollingVariance(std::span<const double> values, size_t window);
+std::vector<double> RollingStdDev(std::span<const double> values, size_t window);
+
+// n - 1 results: values[i + 1] / values[i] - 1 and log(values[i + 1] / values[i]).
+// SimpleReturns uses AVX2 when the CPU has it.  The results are the same either way.
+
+std::vector<double> SimpleReturns(std::span<const double> values);
+std::vector<double> LogReturns(std::span<const double> values);
+
+// --- many series at once ---
+
+enum class RollingStatistic : int32_t
+{
+    e_Sum,
+    e_Mean,
+    e_Min,
+    e_Max,
+    e_Variance,
+    e_StdDev
+};
+
+std::vector<double> ComputeRolling(RollingStatistic statistic, std::span<const double> values, size_t window);
+
+// one result per series, in the same order.  The series are shared among
+// 'thread_count' threads (0 means use all the hardware threads).
+
+std::vector<std::vector<double>> ComputeRollingBatch(RollingStatistic statistic,
+                                                     std::span<const std::vector<double>> series, size_t window,
+                                                     uint32_t thread_count = 0);
+
+#endif /* ROLLING_WINDOW_H_ */
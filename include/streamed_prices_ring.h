@@ -0,0 +1,152 @@
+/* =====================================================================================
+ *
+ * Filename:  streamed_prices_ring.h
+ *
+ * Description:  Fixed capacity storage for streamed prices.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 18:10:05
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef STREAMED_PRICES_RING_H_
+#define STREAMED_PRICES_RING_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <new>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "utilities.h"
+
+// keep each column on its own cache lines.
+
+inline constexpr size_t CacheLineSize = 64;
+
+template <typename T> struct CacheAlignedAllocator
+{
+    using value_type = T;
+
+    CacheAlignedAllocator() = default;
+    template <typename U> CacheAlignedAllocator(const CacheAlignedAllocator<U> &) noexcept
+    {
+    }
+
+    T *allocate(size_t n)
+    {
+        return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{CacheLineSize}));
+    }
+    void deallocate(T *p, size_t /* n */) noexcept
+    {
+        ::operator delete(p, std::align_val_t{CacheLineSize});
+    }
+
+    template <typename U> bool operator==(const CacheAlignedAllocator<U> &) const noexcept
+    {
+        return true;
+    }
+};
+
+// read only look at the prices currently held. Oldest first.
+// Only good until the next Append.
+
+struct StreamedPricesView
+{
+    std::span<const int64_t> timestamp_seconds_;
+    std::span<const double> price_;
+    std::span<const int32_t> signal_type_;
+};
+
+// =====================================================================================
+//        Class:  StreamedPricesRing
+//  Description:  Bounded replacement for StreamedPrices.  Keeps at most 'capacity'
+//                entries and, optionally, only those within 'time_window' of the
+//                newest entry.  All memory is allocated up front so Append is O(1)
+//                and never allocates.
+//
+//                Each column is stored twice, back to back, and every entry is written
+//                to both halves.  That way the live entries are always contiguous so
+//                readers get plain spans without any copying.
+// =====================================================================================
+
+class StreamedPricesRing
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    // a time_window of zero means retain by count only.
+
+    explicit StreamedPricesRing(size_t capacity, std::chrono::seconds time_window = std::chrono::seconds{0});
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] size_t size() const
+    {
+        return size_;
+    }
+    [[nodiscard]] bool empty() const
+    {
+        return size_ == 0;
+    }
+    [[nodiscard]] size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    [[nodiscard]] StreamedPricesView GetView() const
+    {
+        return {{timestamp_seconds_.data() + head_, size_},
+                {price_.data() + head_, size_},
+                {signal_type_.data() + head_, size_}};
+    }
+
+    // copy out to the unbounded form for code which expects it.
+
+    [[nodiscard]] StreamedPrices ToStreamedPrices() const;
+
+    // ====================  MUTATORS      =======================================
+
+    void Append(int64_t timestamp_seconds, double price, int32_t signal_type);
+
+    void clear()
+    {
+        head_ = 0;
+        size_ = 0;
+    }
+
+    // ====================  OPERATORS     =======================================
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+    std::vector<int64_t, CacheAlignedAllocator<int64_t>> timestamp_seconds_;
+    std::vector<double, CacheAlignedAllocator<double>> price_;
+    std::vector<int32_t, CacheAlignedAllocator<int32_t>> signal_type_;
+
+    size_t capacity_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+    int64_t time_window_seconds_;
+
+}; // -----  end of class StreamedPricesRing  -----
+
+using PF_StreamedPricesRing = std::map<std::string, StreamedPricesRing>;
+
+#endif /* STREAMED_PRICES_RING_H_ */
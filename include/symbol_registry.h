@@ -0,0 +1,212 @@
+/* =====================================================================================
+ *
+ * Filename:  symbol_registry.h
+ *
+ * Description:  Map ticker symbols to small dense integer IDs once so per symbol data
+ *               can be kept in flat vectors.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 19:02:51
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef SYMBOL_REGISTRY_H_
+#define SYMBOL_REGISTRY_H_
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "utilities.h"
+
+using SymbolID = uint32_t;
+
+// lets us look up std::string keys with a string_view without building a string.
+
+struct SymbolHash
+{
+    using is_transparent = void;
+    size_t operator()(std::string_view symbol) const noexcept
+    {
+        return std::hash<std::string_view>{}(symbol);
+    }
+};
+
+// =====================================================================================
+//        Class:  SymbolRegistry
+//  Description:  Assigns each distinct symbol the next ID, starting from 0.
+//                IDs are never reused or removed.
+//
+//                Move only: symbols_ points into the nodes of ids_, which a move
+//                takes along but a copy would not.
+// =====================================================================================
+
+class SymbolRegistry
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    SymbolRegistry() = default;
+    SymbolRegistry(const SymbolRegistry &rhs) = delete;
+    SymbolRegistry(SymbolRegistry &&rhs) = default;
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] size_t size() const
+    {
+        return symbols_.size();
+    }
+
+    [[nodiscard]] std::optional<SymbolID> Find(std::string_view symbol) const
+    {
+        if (auto found = ids_.find(symbol); found != ids_.end())
+        {
+            return found->second;
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::string_view GetSymbol(SymbolID id) const
+    {
+        return symbols_[id];
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    // returns the existing ID or adds the symbol.
+
+    SymbolID Intern(std::string_view symbol);
+
+    // ====================  OPERATORS     =======================================
+
+    SymbolRegistry &operator=(const SymbolRegistry &rhs) = delete;
+    SymbolRegistry &operator=(SymbolRegistry &&rhs) = default;
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+    std::unordered_map<std::string, SymbolID, SymbolHash, std::equal_to<>> ids_;
+
+    // these refer to the keys in ids_. Map nodes don't move so these stay valid.
+
+    std::vector<std::string_view> symbols_;
+
+}; // -----  end of class SymbolRegistry  -----
+
+// =====================================================================================
+//        Class:  SymbolTable
+//  Description:  Flat, ID indexed replacement for std::map<std::string, T>.
+//                New entries are copies of the 'prototype' value given at construction.
+//                Several tables can share one registry so a symbol has the same ID in
+//                each of them.
+// =====================================================================================
+
+template <typename T> class SymbolTable
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    explicit SymbolTable(SymbolRegistry &registry, T prototype = T{})
+        : registry_{&registry}, prototype_{std::move(prototype)}
+    {
+    }
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] const SymbolRegistry &GetRegistry() const
+    {
+        return *registry_;
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return values_.size();
+    }
+
+    // nullptr if the symbol has never been seen.
+
+    [[nodiscard]] const T *Find(std::string_view symbol) const
+    {
+        if (auto id = registry_->Find(symbol); id && *id < values_.size())
+        {
+            return &values_[*id];
+        }
+        return nullptr;
+    }
+    [[nodiscard]] T *Find(std::string_view symbol)
+    {
+        return const_cast<T *>(std::as_const(*this).Find(symbol));
+    }
+
+    // visit each (symbol, value) pair in ID order.
+
+    template <typename Func> void ForEach(Func &&func) const
+    {
+        for (SymbolID id = 0; id < values_.size(); ++id)
+        {
+            func(registry_->GetSymbol(id), values_[id]);
+        }
+    }
+
+    // ====================  MUTATORS      =======================================
+
+    // ====================  OPERATORS     =======================================
+
+    // the ID must have come from our registry.
+
+    T &operator[](SymbolID id)
+    {
+        if (id >= values_.size())
+        {
+            values_.resize(registry_->size(), prototype_);
+        }
+        return values_[id];
+    }
+
+    // adds the symbol if needed.
+
+    T &operator[](std::string_view symbol)
+    {
+        return (*this)[registry_->Intern(symbol)];
+    }
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+    SymbolRegistry *registry_;
+    T prototype_;
+    std::vector<T> values_;
+
+}; // -----  end of class SymbolTable  -----
+
+// flat alternatives to PF_StreamedPrices and PF_StreamedSummary.
+
+using PF_StreamedPricesTable = SymbolTable<StreamedPrices>;
+using PF_StreamedSummaryTable = SymbolTable<StreamedSummary>;
+
+#endif /* SYMBOL_REGISTRY_H_ */
@@ -0,0 +1,147 @@
+/* =====================================================================================
+ *
+ * Filename:  trading_calendar.h
+ *
+ * Description:  Precomputed calendar of US market trading days.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 09:12:40
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#ifndef TRADING_CALENDAR_H_
+#define TRADING_CALENDAR_H_
+
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+// =====================================================================================
+//        Class:  TradingCalendar
+//  Description:  Holds one bit per calendar day for a span of years. The bit is set when
+//                the US markets are open on that day.  Built once, lookups are O(1).
+//                Days outside the span fall back to evaluating the holiday rules.
+//
+//                Alongside the bitmap we keep a running count of trading days before
+//                each 64 day block (rank) and the list of trading days themselves
+//                (select) so business day arithmetic is also O(1) within the span.
+// =====================================================================================
+
+class TradingCalendar
+{
+public:
+    // ====================  LIFECYCLE     =======================================
+
+    TradingCalendar(std::chrono::year first_year, std::chrono::year last_year);
+
+    // ====================  ACCESSORS     =======================================
+
+    [[nodiscard]] std::chrono::year GetFirstYear() const
+    {
+        return first_year_;
+    }
+    [[nodiscard]] std::chrono::year GetLastYear() const
+    {
+        return last_year_;
+    }
+
+    [[nodiscard]] bool IsInRange(std::chrono::sys_days a_day) const
+    {
+        return a_day >= first_day_ && a_day <= last_day_;
+    }
+
+    [[nodiscard]] bool IsTradingDay(std::chrono::sys_days a_day) const
+    {
+        if (!IsInRange(a_day))
+        {
+            return IsTradingDayByRule(a_day);
+        }
+        const auto offset = static_cast<uint32_t>((a_day - first_day_).count());
+        return ((trading_days_[offset / 64] >> (offset % 64)) & 1U) != 0;
+    }
+
+    [[nodiscard]] bool IsTradingDay(const std::chrono::year_month_day &a_day) const
+    {
+        return IsTradingDay(std::chrono::sys_days{a_day});
+    }
+
+    // move n trading days forward (n > 0) or backward (n < 0) from the given day.
+    // the given day itself is not counted so it need not be a trading day.
+    // n == 0 returns the given day unchanged.
+
+    [[nodiscard]] std::chrono::sys_days AddBusinessDays(std::chrono::sys_days a_day, int32_t n) const;
+    [[nodiscard]] std::chrono::year_month_day AddBusinessDays(const std::chrono::year_month_day &a_day,
+                                                              int32_t n) const
+    {
+        return std::chrono::year_month_day{AddBusinessDays(std::chrono::sys_days{a_day}, n)};
+    }
+
+    // number of trading days in the half open interval [from, to).
+    // negative if 'to' is before 'from'.
+
+    [[nodiscard]] int32_t BusinessDaysBetween(std::chrono::sys_days from, std::chrono::sys_days to) const;
+    [[nodiscard]] int32_t BusinessDaysBetween(const std::chrono::year_month_day &from,
+                                              const std::chrono::year_month_day &to) const
+    {
+        return BusinessDaysBetween(std::chrono::sys_days{from}, std::chrono::sys_days{to});
+    }
+
+    // the nth (1 based) trading day of the month. empty if the month has fewer trading days.
+
+    [[nodiscard]] std::optional<std::chrono::year_month_day> NthTradingDayOfMonth(std::chrono::year_month which_month,
+                                                                                  int32_t n) const;
+
+    // ====================  MUTATORS      =======================================
+
+    // ====================  OPERATORS     =======================================
+
+protected:
+    // ====================  METHODS       =======================================
+
+    // ====================  DATA MEMBERS  =======================================
+
+private:
+    // ====================  METHODS       =======================================
+
+    static bool IsTradingDayByRule(std::chrono::sys_days a_day);
+
+    // number of trading days in [first_day_, a_day). a_day must be within [first_day_, last_day_ + 1].
+
+    [[nodiscard]] int32_t CountTradingDaysBefore(std::chrono::sys_days a_day) const
+    {
+        const auto offset = static_cast<uint32_t>((a_day - first_day_).count());
+        const auto block = offset / 64;
+        if (block == trading_days_.size())
+        {
+            return static_cast<int32_t>(trading_day_list_.size());
+        }
+        const uint64_t mask = (uint64_t{1} << (offset % 64)) - 1;
+        return static_cast<int32_t>(trading_days_before_block_[block] + std::popcount(trading_days_[block] & mask));
+    }
+
+    // ====================  DATA MEMBERS  =======================================
+
+    std::vector<uint64_t> trading_days_;
+    std::vector<uint32_t> trading_days_before_block_;
+    std::vector<std::chrono::sys_days> trading_day_list_;
+
+    std::chrono::year first_year_;
+    std::chrono::year last_year_;
+    std::chrono::sys_days first_day_;
+    std::chrono::sys_days last_day_;
+
+}; // -----  end of class TradingCalendar  -----
+
+// a shared calendar covering 1900 - 2100. It is built on first use.
+
+const TradingCalendar &GetUS_TradingCalendar();
+
+#endif /* TRADING_CALENDAR_H_ */
@@ -18,9 +18,14 @@
 #ifndef US_HOLIDAYS_H_
 #define US_HOLIDAYS_H_
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <memory_resource>
 #include <optional>
-#include <string>
+#include <span>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -28,88 +33,205 @@ using namespace std::chrono_literals;
 using namespace std::literals;
 
 // Type definition for a single US Market Holiday
-using US_MarketHoliday = std::pair<const std::string, const std::chrono::year_month_day>;
+// the name refers to the static name held by the holiday rule so no allocation is needed.
+using US_MarketHoliday = std::pair<const std::string_view, const std::chrono::year_month_day>;
 // Type definition for a list of US Market Holidays
 using US_MarketHolidays = std::vector<US_MarketHoliday>;
 
+// Easter Sunday for the given year in the Gregorian calendar.
+// This is the anonymous Gregorian algorithm (Meeus/Jones/Butcher) so it can be evaluated at compile time.
+
+constexpr std::chrono::year_month_day EasterSunday(std::chrono::year which_year)
+{
+    const int y = static_cast<int>(which_year);
+    const int a = y % 19;
+    const int b = y / 100;
+    const int c = y % 100;
+    const int d = b / 4;
+    const int e = b % 4;
+    const int f = (b + 8) / 25;
+    const int g = (b - f + 1) / 3;
+    const int h = (19 * a + b - d - g + 15) % 30;
+    const int i = c / 4;
+    const int k = c % 4;
+    const int l = (32 + 2 * e + 2 * i - h - k) % 7;
+    const int m = (a + 11 * h + 22 * l) / 451;
+    const int month = (h + l - 7 * m + 114) / 31;
+    const int day = ((h + l - 7 * m + 114) % 31) + 1;
+    return {which_year, std::chrono::month(month), std::chrono::day(day)};
+}
+
 // --- Individual Holiday Rule Structs ---
+// each rule is constexpr so holiday tables can be computed at compile time.
 
 struct NewYearsHoliday
 {
-    static constexpr char holiday_name_[] = "New Years";
+    static constexpr std::string_view holiday_name_ = "New Years";
     static constexpr std::chrono::month_day holiday_rule_ = std::chrono::January / 1d;
-    std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const;
+    constexpr std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const
+    {
+        std::chrono::sys_days newyears = which_year / holiday_rule_.month() / holiday_rule_.day();
+        std::chrono::year_month_weekday newyearsday{newyears};
+        const std::chrono::weekday which_day = newyearsday.weekday();
+        if (which_day == std::chrono::Sunday)
+        {
+            newyears += std::chrono::days{1};
+        }
+        if (which_day != std::chrono::Saturday)
+        { // If Saturday, no observed holiday.
+            return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{newyears}};
+        }
+        return std::nullopt;
+    }
 };
 
 struct MLKDayHoliday
 {
-    static constexpr char holiday_name_[] = "Martin Luther King Day";
+    static constexpr std::string_view holiday_name_ = "Martin Luther King Day";
     static constexpr std::chrono::month_weekday holiday_rule_ = std::chrono::January / std::chrono::Monday[3];
-    std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const;
+    constexpr std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const
+    {
+        std::chrono::year_month_weekday mlk = {which_year, holiday_rule_.month(), holiday_rule_.weekday_indexed()};
+        return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{mlk}};
+    }
 };
 
 struct WashingtonBdayHoliday
 {
-    static constexpr char holiday_name_[] = "Presidents Day";
+    static constexpr std::string_view holiday_name_ = "Presidents Day";
     static constexpr std::chrono::month_weekday holiday_rule_ = std::chrono::February / std::chrono::Monday[3];
-    std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const;
+    constexpr std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const
+    {
+        std::chrono::year_month_weekday wbd = {which_year, holiday_rule_.month(), holiday_rule_.weekday_indexed()};
+        return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{wbd}};
+    }
 };
 
 struct GoodFridayHoliday
 {
-    static constexpr char holiday_name_[] = "Good Friday";
+    static constexpr std::string_view holiday_name_ = "Good Friday";
     static constexpr std::chrono::month_day holiday_rule_ = {};
-    std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const;
+    constexpr std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const
+    {
+        std::chrono::sys_days good_friday_sys_days =
+            std::chrono::sys_days{EasterSunday(which_year)} - std::chrono::days{2};
+        return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{good_friday_sys_days}};
+    }
 };
 
 struct MemorialDayHoliday
 {
-    static constexpr char holiday_name_[] = "Memorial Day";
+    static constexpr std::string_view holiday_name_ = "Memorial Day";
     static constexpr std::chrono::month_weekday_last holiday_rule_ =
         std::chrono::May / std::chrono::Monday[std::chrono::last];
-    std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const;
+    constexpr std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const
+    {
+        std::chrono::year_month_weekday_last md = {which_year, holiday_rule_.month(), holiday_rule_.weekday_last()};
+        return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{md}};
+    }
 };
 
 struct JuneteenthHoliday
 {
-    static constexpr char holiday_name_[] = "Juneteenth";
+    static constexpr std::string_view holiday_name_ = "Juneteenth";
     static constexpr std::chrono::month_day holiday_rule_ = std::chrono::June / 19d;
-    std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const;
+    constexpr std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const
+    {
+        if (which_year >= 2022y)
+        { // first use of this holiday is 2022
+            std::chrono::sys_days hday = which_year / holiday_rule_.month() / holiday_rule_.day();
+            std::chrono::year_month_weekday hwday{hday};
+            const std::chrono::weekday which_day = hwday.weekday();
+            if (which_day == std::chrono::Sunday)
+            {
+                hday += std::chrono::days{1};
+            }
+            else if (which_day == std::chrono::Saturday)
+            {
+                hday -= std::chrono::days{1};
+            }
+            return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{hday}};
+        }
+        return std::nullopt;
+    }
 };
 
 struct IndependenceDayHoliday
 {
-    static constexpr char holiday_name_[] = "Independence Day";
+    static constexpr std::string_view holiday_name_ = "Independence Day";
     static constexpr std::chrono::month_day holiday_rule_ = std::chrono::July / 4d;
-    std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const;
+    constexpr std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const
+    {
+        std::chrono::sys_days hday = which_year / holiday_rule_.month() / holiday_rule_.day();
+        std::chrono::year_month_weekday hwday{hday};
+        const std::chrono::weekday which_day = hwday.weekday();
+        if (which_day == std::chrono::Sunday)
+        {
+            hday += std::chrono::days{1};
+        }
+        else if (which_day == std::chrono::Saturday)
+        {
+            hday -= std::chrono::days{1};
+        }
+        return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{hday}};
+    }
 };
 
 struct LaborDayHoliday
 {
-    static constexpr char holiday_name_[] = "Labor Day";
+    static constexpr std::string_view holiday_name_ = "Labor Day";
     static constexpr std::chrono::month_weekday holiday_rule_ = std::chrono::September / std::chrono::Monday[1];
-    std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const;
+    constexpr std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const
+    {
+        std::chrono::year_month_weekday ld = {which_year, holiday_rule_.month(), holiday_rule_.weekday_indexed()};
+        return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{ld}};
+    }
 };
 
 struct ThanksgivingHoliday
 {
-    static constexpr char holiday_name_[] = "Thanksgiving Day";
+    static constexpr std::string_view holiday_name_ = "Thanksgiving Day";
     static constexpr std::chrono::month_weekday holiday_rule_ = std::chrono::November / std::chrono::Thursday[4];
-    std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const;
+    constexpr std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const
+    {
+        std::chrono::year_month_weekday tg = {which_year, holiday_rule_.month(), holiday_rule_.weekday_indexed()};
+        return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{tg}};
+    }
 };
 
 struct ChristmasHoliday
 {
-    static constexpr char holiday_name_[] = "Christmas Day";
+    static constexpr std::string_view holiday_name_ = "Christmas Day";
     static constexpr std::chrono::month_day holiday_rule_ = std::chrono::December / 25d;
-    std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const;
+    constexpr std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const
+    {
+        std::chrono::sys_days hday = which_year / holiday_rule_.month() / holiday_rule_.day();
+        std::chrono::year_month_weekday hwday{hday};
+        const std::chrono::weekday which_day = hwday.weekday();
+        if (which_day == std::chrono::Sunday)
+        {
+            hday += std::chrono::days{1};
+        }
+        else if (which_day == std::chrono::Saturday)
+        {
+            hday -= std::chrono::days{1};
+        }
+        return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{hday}};
+    }
 };
 
 struct CartersDayHoliday
 {
-    static constexpr char holiday_name_[] = "Carter Memorial";
+    static constexpr std::string_view holiday_name_ = "Carter Memorial";
     static constexpr std::chrono::year_month_day holiday_rule_ = 2025y / std::chrono::January / 9d;
-    std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const;
+    constexpr std::optional<US_MarketHoliday> operator()(std::chrono::year which_year) const
+    {
+        if (which_year == holiday_rule_.year())
+        {
+            return US_MarketHoliday{holiday_name_, holiday_rule_};
+        }
+        return std::nullopt;
+    }
 };
 
 // Type alias for the variant of all holiday rule structs
@@ -117,7 +239,74 @@ using HolidayRuleVariant = std::variant<NewYearsHoliday, MLKDayHoliday, Washingt
                                         MemorialDayHoliday, JuneteenthHoliday, IndependenceDayHoliday, LaborDayHoliday,
                                         ThanksgivingHoliday, ChristmasHoliday, CartersDayHoliday>;
 
+// The list of holiday rules we apply, in the order they are applied.
+inline constexpr std::array<HolidayRuleVariant, std::variant_size_v<HolidayRuleVariant>> US_MarketHolidayRules = {
+    NewYearsHoliday{},     MLKDayHoliday{},     WashingtonBdayHoliday{},  GoodFridayHoliday{},
+    MemorialDayHoliday{},  JuneteenthHoliday{}, IndependenceDayHoliday{}, LaborDayHoliday{},
+    ThanksgivingHoliday{}, ChristmasHoliday{},  CartersDayHoliday{}};
+
 // Function to generate a list of US market holidays for the given year
 US_MarketHolidays MakeHolidayList(std::chrono::year which_year);
 
+// same list allocated from 'resource'.
+
+using PMR_US_MarketHolidays = std::pmr::vector<US_MarketHoliday>;
+
+PMR_US_MarketHolidays MakeHolidayList(std::chrono::year which_year, std::pmr::memory_resource *resource);
+
+// --- Compile time holiday tables ---
+
+// apply each holiday rule for the given year, passing each holiday found to 'func'.
+
+template <typename Func> constexpr void ForEachUS_MarketHoliday(std::chrono::year which_year, Func &&func)
+{
+    for (const auto &h_rule : US_MarketHolidayRules)
+    {
+        std::visit(
+            [&](const auto &rule_struct) {
+                if (auto holiday = rule_struct(which_year); holiday)
+                {
+                    func(*holiday);
+                }
+            },
+            h_rule);
+    }
+}
+
+constexpr int32_t CountUS_MarketHolidays(std::chrono::year first_year, std::chrono::year last_year)
+{
+    int32_t how_many = 0;
+    for (auto which_year = first_year; which_year <= last_year; ++which_year)
+    {
+        ForEachUS_MarketHoliday(which_year, [&how_many](const US_MarketHoliday &) { ++how_many; });
+    }
+    return how_many;
+}
+
+// Generate a sorted table of all market holiday dates for the years [FirstYear, LastYear].
+// e.g. static constexpr auto holidays = MakeUS_MarketHolidayTable<1990, 2050>();
+
+template <int FirstYear, int LastYear>
+    requires(FirstYear <= LastYear)
+consteval auto MakeUS_MarketHolidayTable()
+{
+    constexpr auto how_many = CountUS_MarketHolidays(std::chrono::year{FirstYear}, std::chrono::year{LastYear});
+    std::array<std::chrono::year_month_day, how_many> table{};
+
+    size_t next = 0;
+    for (auto which_year = std::chrono::year{FirstYear}; which_year <= std::chrono::year{LastYear}; ++which_year)
+    {
+        ForEachUS_MarketHoliday(which_year,
+                                [&table, &next](const US_MarketHoliday &holiday) { table[next++] = holiday.second; });
+    }
+    std::ranges::sort(table);
+    return table;
+}
+
+constexpr bool IsUS_MarketHoliday(std::span<const std::chrono::year_month_day> holiday_table,
+                                  const std::chrono::year_month_day &a_day)
+{
+    return std::ranges::binary_search(holiday_table, a_day);
+}
+
 #endif /* US_HOLIDAYS_H_ */
@@ -25,7 +25,9 @@
 #include <iterator>
 #include <locale>
 #include <map>
+#include <memory_resource>
 #include <ranges>
+#include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -44,26 +46,49 @@ using Decimal = bd::decimal64_t;
 
 namespace fs = std::filesystem;
 
+// any of the Boost Decimal types: decimal32_t, decimal64_t, decimal128_t, ...
+
+template <typename T>
+concept DecimalFloatingPoint = bd::detail::is_decimal_floating_point_v<T>;
+
 // function to mimic output from mpdecimal's exponent function
 // for the Boost Decimal library
 
-inline int GetExponent(const Decimal &val)
+template <DecimalFloatingPoint T> constexpr int GetExponent(const T &val)
 {
-    return -(static_cast<int>(bd::quantexp(val)) - bd::detail::bias_v<Decimal>);
+    return -(static_cast<int>(bd::quantexp(val)) - bd::detail::bias_v<T>);
 }
 
-// Helper to scale by fractional digits instead of total significant digits
-template <typename T>
-    requires std::is_same_v<T, bd::decimal64_t> // or generic
-auto rescale_dpr(T value, int fractional_digits)
+// Helper to scale by fractional digits instead of total significant digits.
+// frexp10 gives us the significand normalized to the full precision of the type so
+// the number of digits before the decimal point falls out of the exponent -- no
+// integer conversion or string needed.  A value < 1 (including 0) counts as 1 digit,
+// same as the whole part '0' would.
+
+template <DecimalFloatingPoint T> constexpr int CountDigitsBeforeDecimalPoint(T value)
 {
-    // 1. Get the whole number part as a standard 64-bit integer
-    // 2. Convert to string and find how many digits sit before the decimal point
-    auto whole_part = static_cast<long long>(bd::trunc(value));
-    int digits_before_dot = std::to_string(std::abs(whole_part)).length();
+    int exponent = 0;
+    const auto significand = bd::frexp10(value, &exponent);
+    if (significand == 0)
+    {
+        return 1;
+    }
+    return std::max(1, bd::detail::precision_v<T> + exponent);
+}
 
-    // 3. Add that count to your desired fractional digits to feed into rescale
-    return bd::rescale(value, digits_before_dot + fractional_digits);
+template <DecimalFloatingPoint T> constexpr T rescale_dpr(T value, int fractional_digits)
+{
+    return bd::rescale(value, CountDigitsBeforeDecimalPoint(value) + fractional_digits);
+}
+
+// rescale a whole batch in place.
+
+template <DecimalFloatingPoint T> constexpr void rescale_dpr(std::span<T> values, int fractional_digits)
+{
+    for (auto &value : values)
+    {
+        value = rescale_dpr(value, fractional_digits);
+    }
 }
 
 // keep our database related parms together
@@ -81,6 +106,8 @@ struct StreamedPrices
 
 using PF_StreamedPrices = std::map<std::string, StreamedPrices>;
 
+// for a bounded, allocation free alternative see StreamedPricesRing in streamed_prices_ring.h
+
 // we keep track of overall movement for streamed data --
 // the open and most recent price for each symbol.
 
@@ -103,6 +130,60 @@ struct StockDataRecord
     Decimal close_;
 };
 
+// same as StockDataRecord but the strings come from a std::pmr::memory_resource so a whole
+// batch of records can live in one arena (e.g. a monotonic_buffer_resource) and be
+// released at once.  Allocator aware so a std::pmr::vector passes its resource along.
+
+struct PMR_StockDataRecord
+{
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    PMR_StockDataRecord() = default;
+    explicit PMR_StockDataRecord(const allocator_type &alloc) : date_{alloc}, symbol_{alloc}
+    {
+    }
+    PMR_StockDataRecord(const PMR_StockDataRecord &rhs) = default;
+    PMR_StockDataRecord(PMR_StockDataRecord &&rhs) = default;
+    PMR_StockDataRecord(const PMR_StockDataRecord &rhs, const allocator_type &alloc)
+        : date_{rhs.date_, alloc},
+          symbol_{rhs.symbol_, alloc},
+          open_{rhs.open_},
+          high_{rhs.high_},
+          low_{rhs.low_},
+          close_{rhs.close_}
+    {
+    }
+    PMR_StockDataRecord(PMR_StockDataRecord &&rhs, const allocator_type &alloc)
+        : date_{std::move(rhs.date_), alloc},
+          symbol_{std::move(rhs.symbol_), alloc},
+          open_{rhs.open_},
+          high_{rhs.high_},
+          low_{rhs.low_},
+          close_{rhs.close_}
+    {
+    }
+
+    PMR_StockDataRecord &operator=(const PMR_StockDataRecord &rhs) = default;
+    PMR_StockDataRecord &operator=(PMR_StockDataRecord &&rhs) = default;
+
+    [[nodiscard]] allocator_type get_allocator() const
+    {
+        return date_.get_allocator();
+    }
+
+    explicit operator StockDataRecord() const
+    {
+        return {std::string{date_}, std::string{symbol_}, open_, high_, low_, close_};
+    }
+
+    std::pmr::string date_;
+    std::pmr::string symbol_;
+    Decimal open_;
+    Decimal high_;
+    Decimal low_;
+    Decimal close_;
+};
+
 struct TopOfBookOpenAndLastClose
 {
     std::string symbol_;
@@ -145,34 +226,111 @@ struct line_only_whitespace : std::ctype<char>
 
 //  let's do a little 'template normal' programming again
 
-// function to split a string on a delimiter and return a vector of items.
-// use concepts to restrict to strings and string_views.
+// vectorized single character search used by the split code below.
+// An AVX2, SSE4.2 or plain implementation is picked at run time based on the CPU.
+// Both return/count within [first, last). FindChar returns last if not found.
 
-template <typename T>
-inline std::vector<T> split_string(std::string_view string_data, std::string_view delim)
-    requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+namespace char_search
 {
-    std::vector<T> results;
+const char *FindChar(const char *first, const char *last, char c);
+size_t CountChar(const char *first, const char *last, char c);
+} // namespace char_search
+
+// function to split a string on a delimiter and pass each item to 'func' as a string_view.
+// nothing is materialized so this is the cheapest way to look at each item.
+// NOTE: as with all the versions below, a trailing delimiter does not produce a trailing empty item.
+
+template <typename Func>
+inline void split_string_for_each(std::string_view string_data, std::string_view delim, Func &&func)
+    requires std::is_invocable_v<Func, std::string_view>
+{
+    if (delim.size() == 1)
+    {
+        // the usual case. use our vectorized search.
+
+        const char *it = string_data.data();
+        const char *last = string_data.data() + string_data.size();
+        while (it < last)
+        {
+            const char *pos = char_search::FindChar(it, last, delim[0]);
+            func(std::string_view(it, pos - it));
+            if (pos == last)
+            {
+                break;
+            }
+            it = pos + 1;
+        }
+        return;
+    }
     for (size_t it = 0; it < string_data.size(); ++it)
     {
         auto pos = string_data.find(delim, it);
-        if (pos != T::npos)
+        if (pos != std::string_view::npos)
         {
-            results.emplace_back(string_data.substr(it, pos - it));
+            func(string_data.substr(it, pos - it));
         }
         else
         {
-            results.emplace_back(string_data.substr(it));
+            func(string_data.substr(it));
             break;
         }
         it = pos;
     }
+}
+
+// function to split a string on a delimiter and write the items to an output iterator.
+
+template <typename T, typename OutIter>
+inline OutIter split_string(std::string_view string_data, std::string_view delim, OutIter out)
+    requires(std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>) && std::output_iterator<OutIter, T>
+{
+    split_string_for_each(string_data, delim, [&out](std::string_view item) { *out++ = T{item}; });
+    return out;
+}
+
+// function to split a string on a delimiter and return a vector of items.
+// use concepts to restrict to strings and string_views.
+// for single character delimiters we count first so we can reserve exactly.
+
+template <typename T>
+inline std::vector<T> split_string(std::string_view string_data, std::string_view delim)
+    requires std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+{
+    std::vector<T> results;
+    if (delim.size() == 1 && !string_data.empty())
+    {
+        const auto how_many = char_search::CountChar(string_data.data(), string_data.data() + string_data.size(),
+                                                     delim[0]) +
+                              (string_data.back() == delim[0] ? 0 : 1);
+        results.reserve(how_many);
+    }
+    split_string_for_each(string_data, delim, [&results](std::string_view item) { results.emplace_back(item); });
+    return results;
+}
+
+// same as above but the vector (and, for std::pmr::string, each item) is allocated from 'resource'.
+
+template <typename T>
+inline std::pmr::vector<T> split_string(std::string_view string_data, std::string_view delim,
+                                        std::pmr::memory_resource *resource)
+    requires std::is_same_v<T, std::pmr::string> || std::is_same_v<T, std::string_view>
+{
+    std::pmr::vector<T> results{resource};
+    if (delim.size() == 1 && !string_data.empty())
+    {
+        const auto how_many = char_search::CountChar(string_data.data(), string_data.data() + string_data.size(),
+                                                     delim[0]) +
+                              (string_data.back() == delim[0] ? 0 : 1);
+        results.reserve(how_many);
+    }
+    split_string_for_each(string_data, delim, [&results](std::string_view item) { results.emplace_back(item); });
     return results;
 }
 
 // here's a ranges based version of the split code above.
 // this advantage of using this version is that it is lazy --
 // no requirement to split the whole input up front.
+// For CSV data (quoted fields, picking out a few columns) see DelimitedFields in delimited_fields.h.
 
 template <typename T>
 inline auto rng_split_string(std::string_view string_data, std::string_view delim)
@@ -188,13 +346,19 @@ inline auto rng_split_string(std::string_view string_data, std::string_view deli
 }
 
 // a (hopefully) efficient way to read an entire file into a string.  Does a binary read.
+// for large files that only need to be read, consider using a MappedFile (mapped_file.h) instead.
 
 std::string LoadDataFileForUse(const fs::path &file_name);
 
 // common code to read in some JSON data and parse it out.
+// regular files are memory mapped and parsed in place.
 
 Json::Value ReadAndParsePF_ChartJSONFile(const fs::path &symbol_file_name);
 
+// parse JSON text we already have in memory (a string, a MappedFile, etc.)
+
+Json::Value ParseJSONData(std::string_view json_data);
+
 enum class UpOrDown : int32_t
 {
     e_Down,
@@ -222,6 +386,10 @@ std::chrono::year_month_day StringToDateYMD(std::string_view input_format, std::
 
 using US_MarketTime = std::chrono::zoned_seconds;
 
+// the time zone US markets operate in (America/New_York).
+
+const std::chrono::time_zone *GetUS_MarketTimeZone();
+
 US_MarketTime GetUS_MarketOpenTime(const std::chrono::year_month_day &a_day);
 US_MarketTime GetUS_MarketCloseTime(const std::chrono::year_month_day &a_day);
 
@@ -235,18 +403,27 @@ enum class US_MarketStatus : int32_t
 
 US_MarketStatus GetUS_MarketStatus(std::string_view local_time_zone_name, std::chrono::local_seconds a_time);
 
+// for repeated status checks (e.g. every tick) see MarketSessionClock in market_session_clock.h
+
 // some more date related functions related to our point and figure project
 //
 // Generate a list of US market holidays for the given year
 // NOTE: List will contain day holidays are observed by market, not necessarily
 // the actual date of the holiday
 
-using US_MarketHoliday = std::pair<const std::string, const std::chrono::year_month_day>;
+using US_MarketHoliday = std::pair<const std::string_view, const std::chrono::year_month_day>;
 using US_MarketHolidays = std::vector<US_MarketHoliday>;
 
 US_MarketHolidays MakeHolidayList(std::chrono::year which_year);
 
+// same list allocated from 'resource'.
+
+using PMR_US_MarketHolidays = std::pmr::vector<US_MarketHoliday>;
+
+PMR_US_MarketHolidays MakeHolidayList(std::chrono::year which_year, std::pmr::memory_resource *resource);
+
 // see if the US Stock market is open on the given day.
+// uses the shared precomputed trading calendar so this is cheap to call in loops.
 
 bool IsUS_MarketOpen(const std::chrono::year_month_day &a_day);
 
@@ -258,6 +435,26 @@ std::vector<std::chrono::year_month_day> ConstructeBusinessDayList(std::chrono::
                                                                    size_t how_many_business_days, UpOrDown order,
                                                                    const US_MarketHolidays *holidays = nullptr);
 
+// same as above but uses a precomputed trading calendar to decide which days are business days.
+
+class TradingCalendar;
+
+std::vector<std::chrono::year_month_day> ConstructeBusinessDayList(std::chrono::year_month_day start_from,
+                                                                   size_t how_many_business_days, UpOrDown order,
+                                                                   const TradingCalendar &calendar);
+
+// same as the 2 above but the list is allocated from 'resource'.
+
+std::pmr::vector<std::chrono::year_month_day> ConstructeBusinessDayList(std::chrono::year_month_day start_from,
+                                                                        size_t how_many_business_days, UpOrDown order,
+                                                                        const US_MarketHolidays *holidays,
+                                                                        std::pmr::memory_resource *resource);
+
+std::pmr::vector<std::chrono::year_month_day> ConstructeBusinessDayList(std::chrono::year_month_day start_from,
+                                                                        size_t how_many_business_days, UpOrDown order,
+                                                                        const TradingCalendar &calendar,
+                                                                        std::pmr::memory_resource *resource);
+
 // this function will generate a pair of dates which spans the specified number of business days, optionally
 // taking holidays into account.  the starting date is included.
 
@@ -265,11 +462,40 @@ std::pair<std::chrono::year_month_day, std::chrono::year_month_day> ConstructeBu
     std::chrono::year_month_day start_from, int how_many_business_days, UpOrDown order,
     const US_MarketHolidays *holidays = nullptr);
 
-// bridge between Tiingo price history data and DB price history data
+// same as above but answered in constant time from the trading calendar's indexes.
+
+std::pair<std::chrono::year_month_day, std::chrono::year_month_day> ConstructeBusinessDayRange(
+    std::chrono::year_month_day start_from, int how_many_business_days, UpOrDown order,
+    const TradingCalendar &calendar);
+
+// bridge between Tiingo price history data and DB price history data. Single threaded.
 
 std::vector<StockDataRecord> ConvertJSONPriceHistory(const std::string &symbol, const Json::Value &the_data,
                                                      uint32_t how_many_days, UseAdjusted use_adjusted);
 
+// same as above but converts blocks of rows on up to 'thread_count' threads (0 means one
+// per core). Small histories are still done on the calling thread. Same output order.
+
+std::vector<StockDataRecord> ConvertJSONPriceHistory(const std::string &symbol, const Json::Value &the_data,
+                                                     uint32_t how_many_days, UseAdjusted use_adjusted,
+                                                     uint32_t thread_count);
+
+// same as above but the records, and their strings, are allocated from 'resource'.
+// Always done on the calling thread since memory resources like monotonic_buffer_resource
+// are not thread safe.  A separate name so a literal 0 thread count above is never
+// mistaken for a null resource.
+
+std::pmr::vector<PMR_StockDataRecord> ConvertJSONPriceHistoryPMR(const std::string &symbol,
+                                                                 const Json::Value &the_data, uint32_t how_many_days,
+                                                                 UseAdjusted use_adjusted,
+                                                                 std::pmr::memory_resource *resource);
+
+// same result as above but reads straight from the JSON text (e.g. from a MappedFile)
+// without building a Json::Value first.  Stops reading after 'how_many_days' rows.
+
+std::vector<StockDataRecord> ParseJSONPriceHistory(const std::string &symbol, std::string_view json_text,
+                                                   uint32_t how_many_days, UseAdjusted use_adjusted);
+
 // help us out for testing
 
 // template <>
@@ -313,6 +539,21 @@ struct std::formatter<StockDataRecord> : std::formatter<std::string>
     }
 };
 
+// same layout for the pmr version
+
+template <>
+struct std::formatter<PMR_StockDataRecord> : std::formatter<std::string>
+{
+    // parse is inherited from formatter<string>.
+    auto format(const PMR_StockDataRecord &pdr, std::format_context &ctx) const
+    {
+        std::string record;
+        std::format_to(std::back_inserter(record), "{}, {}, {}, {}, {}, {}", pdr.date_, pdr.symbol_, pdr.open_,
+                       pdr.high_, pdr.low_, pdr.close_);
+        return formatter<std::string>::format(record, ctx);
+    }
+};
+
 // custom formatter for PriceDataRecord
 
 template <>
@@ -0,0 +1,156 @@
+/* =====================================================================================
+ *
+ * Filename:  char_search.cpp
+ *
+ * Description:  Vectorized single character search and count with run time
+ *               selection of AVX2, SSE4.2 or plain code.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 15:48:22
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CHAR_SEARCH_HAVE_X86_
+#endif
+
+#include "utilities.h"
+
+namespace
+{
+using FindCharFn = const char *(*)(const char *, const char *, char);
+using CountCharFn = size_t (*)(const char *, const char *, char);
+
+const char *FindCharScalar(const char *first, const char *last, char c)
+{
+    const auto *pos = static_cast<const char *>(std::memchr(first, c, last - first));
+    return pos != nullptr ? pos : last;
+}
+
+size_t CountCharScalar(const char *first, const char *last, char c)
+{
+    return static_cast<size_t>(std::count(first, last, c));
+}
+
+#ifdef CHAR_SEARCH_HAVE_X86_
+
+__attribute__((target("sse4.2"))) const char *FindCharSSE42(const char *first, const char *last, char c)
+{
+    const __m128i needle = _mm_set1_epi8(c);
+    for (; last - first >= 16; first += 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+        if (const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)); mask != 0)
+        {
+            return first + __builtin_ctz(mask);
+        }
+    }
+    return FindCharScalar(first, last, c);
+}
+
+__attribute__((target("sse4.2,popcnt"))) size_t CountCharSSE42(const char *first, const char *last, char c)
+{
+    const __m128i needle = _mm_set1_epi8(c);
+    size_t how_many = 0;
+    for (; last - first >= 16; first += 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+        how_many += _mm_popcnt_u32(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle))));
+    }
+    return how_many + CountCharScalar(first, last, c);
+}
+
+__attribute__((target("avx2"))) const char *FindCharAVX2(const char *first, const char *last, char c)
+{
+    const __m256i needle = _mm256_set1_epi8(c);
+    for (; last - first >= 32; first += 32)
+    {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+        if (const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+            mask != 0)
+        {
+            return first + __builtin_ctz(mask);
+        }
+    }
+    return FindCharSSE42(first, last, c);
+}
+
+__attribute__((target("avx2,popcnt"))) size_t CountCharAVX2(const char *first, const char *last, char c)
+{
+    const __m256i needle = _mm256_set1_epi8(c);
+    size_t how_many = 0;
+    for (; last - first >= 32; first += 32)
+    {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+        how_many += _mm_popcnt_u32(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle))));
+    }
+    return how_many + CountCharSSE42(first, last, c);
+}
+
+#endif
+
+FindCharFn SelectFindChar()
+{
+#ifdef CHAR_SEARCH_HAVE_X86_
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return FindCharAVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2"))
+    {
+        return FindCharSSE42;
+    }
+#endif
+    return FindCharScalar;
+}
+
+CountCharFn SelectCountChar()
+{
+#ifdef CHAR_SEARCH_HAVE_X86_
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+    {
+        return CountCharAVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt"))
+    {
+        return CountCharSSE42;
+    }
+#endif
+    return CountCharScalar;
+}
+} // namespace
+
+// ===  FUNCTION  ======================================================================
+//         Name:  char_search::FindChar
+//  Description:  the implementation is chosen on first use.
+// =====================================================================================
+
+const char *char_search::FindChar(const char *first, const char *last, char c)
+{
+    static const FindCharFn find_char = SelectFindChar();
+    return find_char(first, last, c);
+} // -----  end of function char_search::FindChar  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  char_search::CountChar
+//  Description:  the implementation is chosen on first use.
+// =====================================================================================
+
+size_t char_search::CountChar(const char *first, const char *last, char c)
+{
+    static const CountCharFn count_char = SelectCountChar();
+    return count_char(first, last, c);
+} // -----  end of function char_search::CountChar  -----
@@ -0,0 +1,132 @@
+/* =====================================================================================
+ *
+ * Filename:  concurrent_tick_ingestor.cpp
+ *
+ * Description:  Implementation of lock-free tick ingestion.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 20:31:56
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "concurrent_tick_ingestor.h"
+
+namespace
+{
+inline void CPU_Relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+} // namespace
+
+// ===  FUNCTION  ======================================================================
+//         Name:  SeqLockedSummary::Read
+//  Description:  retry until we get a copy no writer touched while we were reading.
+// =====================================================================================
+
+StreamedSummary SeqLockedSummary::Read() const
+{
+    StreamedSummary result;
+    for (;;)
+    {
+        const auto before = sequence_.load(std::memory_order_acquire);
+        if ((before & 1) != 0)
+        {
+            CPU_Relax();
+            continue;
+        }
+        result.opening_price_ = opening_price_.load(std::memory_order_relaxed);
+        result.latest_price_ = latest_price_.load(std::memory_order_relaxed);
+        result.curent_signal_type_ = signal_type_.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) == before)
+        {
+            return result;
+        }
+    }
+} // -----  end of method SeqLockedSummary::Read  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  SeqLockedSummary::Update
+//  Description:  an odd sequence number means a write is in progress. We only hold
+//                it for a few stores.
+// =====================================================================================
+
+void SeqLockedSummary::Update(double latest_price, int32_t signal_type)
+{
+    auto sequence = sequence_.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        if ((sequence & 1) != 0)
+        {
+            CPU_Relax();
+            sequence = sequence_.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (sequence_.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                            std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (!have_opening_price_.load(std::memory_order_relaxed))
+    {
+        opening_price_.store(latest_price, std::memory_order_relaxed);
+        have_opening_price_.store(true, std::memory_order_relaxed);
+    }
+    latest_price_.store(latest_price, std::memory_order_relaxed);
+    signal_type_.store(signal_type, std::memory_order_relaxed);
+
+    sequence_.store(sequence + 2, std::memory_order_release);
+} // -----  end of method SeqLockedSummary::Update  -----
+
+ConcurrentTickIngestor::ConcurrentTickIngestor(size_t how_many_symbols, size_t queue_capacity_per_symbol)
+{
+    symbols_.reserve(how_many_symbols);
+    for (size_t i = 0; i < how_many_symbols; ++i)
+    {
+        symbols_.push_back(std::make_unique<PerSymbol>(queue_capacity_per_symbol));
+    }
+} // -----  end of method ConcurrentTickIngestor::ConcurrentTickIngestor  -----
+
+bool ConcurrentTickIngestor::PushTick(SymbolID id, const StreamedTick &tick)
+{
+    auto &symbol = *symbols_[id];
+    symbol.summary_.Update(tick.price_, tick.signal_type_);
+    return symbol.ticks_.TryPush(tick);
+} // -----  end of method ConcurrentTickIngestor::PushTick  -----
+
+size_t ConcurrentTickIngestor::DrainTicks(SymbolID id, StreamedPricesRing &prices)
+{
+    return DrainTicks(id, [&prices](const StreamedTick &tick) {
+        prices.Append(tick.timestamp_seconds_, tick.price_, tick.signal_type_);
+    });
+} // -----  end of method ConcurrentTickIngestor::DrainTicks  -----
+
+size_t ConcurrentTickIngestor::DrainTicks(SymbolID id, StreamedPrices &prices)
+{
+    return DrainTicks(id, [&prices](const StreamedTick &tick) {
+        prices.timestamp_seconds_.push_back(tick.timestamp_seconds_);
+        prices.price_.push_back(tick.price_);
+        prices.signal_type_.push_back(tick.signal_type_);
+    });
+} // -----  end of method ConcurrentTickIngestor::DrainTicks  -----
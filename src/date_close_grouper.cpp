@@ -0,0 +1,353 @@
+/* =====================================================================================
+ *
+ * Filename:  date_close_grouper.cpp
+ *
+ * Description:  Implementation of the radix sort / external merge sort grouping of
+ *               multi symbol date/close data.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 18:20:52
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <format>
+#include <fstream>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <tuple>
+#include <utility>
+
+#include "date_close_grouper.h"
+
+namespace
+{
+using UTC_TimePoint = GroupedDateCloses::UTC_TimePoint;
+
+constexpr uint64_t sign_bit = uint64_t{1} << 63;
+
+uint64_t ToDateKey(UTC_TimePoint date)
+{
+    return static_cast<uint64_t>(date.time_since_epoch().count()) ^ sign_bit;
+}
+
+UTC_TimePoint FromDateKey(uint64_t key)
+{
+    return UTC_TimePoint{UTC_TimePoint::duration{static_cast<UTC_TimePoint::rep>(key ^ sign_bit)}};
+}
+
+// run files from different groupers, or different processes, must not collide.
+
+fs::path MakeRunFileName(const fs::path &directory)
+{
+    static const auto process_tag = std::random_device{}();
+    static std::atomic<uint64_t> run_counter{0};
+    return directory / std::format("date_close_grouper_{:08x}_{}.run", process_tag, run_counter++);
+}
+} // namespace
+
+DateCloseGrouper::DateCloseGrouper(DateCloseGrouperOptions options)
+    : options_{std::move(options)},
+      max_rows_in_memory_{std::max(size_t{1024}, options_.memory_budget_bytes_ / (2 * sizeof(Row)))}
+{
+    // we need room for the rows and the same again to sort them.
+
+    if (options_.temporary_directory_.empty())
+    {
+        options_.temporary_directory_ = fs::temp_directory_path();
+    }
+} // -----  end of method DateCloseGrouper::DateCloseGrouper  -----
+
+DateCloseGrouper::~DateCloseGrouper()
+{
+    RemoveRunFiles();
+} // -----  end of method DateCloseGrouper::~DateCloseGrouper  -----
+
+void DateCloseGrouper::Add(std::string_view symbol, UTC_TimePoint date, Decimal close)
+{
+    rows_.push_back({ToDateKey(date), close, registry_.Intern(symbol)});
+    ++how_many_rows_;
+    if (rows_.size() >= max_rows_in_memory_)
+    {
+        WriteRun();
+    }
+} // -----  end of method DateCloseGrouper::Add  -----
+
+void DateCloseGrouper::Add(std::span<const MultiSymbolDateCloseRecord> records)
+{
+    rows_.reserve(std::min(max_rows_in_memory_, rows_.size() + records.size()));
+    for (const auto &record : records)
+    {
+        Add(record.symbol_, record.date_, record.close_);
+    }
+} // -----  end of method DateCloseGrouper::Add  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  DateCloseGrouper::Finish
+//  Description:  the rows arrive grouped by symbol so we just note where each
+//                symbol starts.
+// =====================================================================================
+
+GroupedDateCloses DateCloseGrouper::Finish()
+{
+    GroupedDateCloses result;
+    result.dates_.reserve(how_many_rows_);
+    result.closes_.reserve(how_many_rows_);
+    result.offsets_.reserve(registry_.size() + 1);
+
+    ForEachSortedRow([&result](const Row &row) {
+        while (result.offsets_.size() <= row.symbol_id_)
+        {
+            result.offsets_.push_back(result.dates_.size());
+        }
+        result.dates_.push_back(FromDateKey(row.date_key_));
+        result.closes_.push_back(row.close_);
+    });
+    while (result.offsets_.size() <= registry_.size())
+    {
+        result.offsets_.push_back(result.dates_.size());
+    }
+
+    result.registry_ = std::exchange(registry_, SymbolRegistry{});
+    return result;
+} // -----  end of method DateCloseGrouper::Finish  -----
+
+void DateCloseGrouper::Finish(const DateCloseGroupHandler &handler)
+{
+    std::vector<UTC_TimePoint> dates;
+    std::vector<Decimal> closes;
+    SymbolID current_id = 0;
+
+    auto pass_on_series = [&] {
+        if (!dates.empty())
+        {
+            handler(registry_.GetSymbol(current_id), dates, closes);
+            dates.clear();
+            closes.clear();
+        }
+    };
+
+    ForEachSortedRow([&](const Row &row) {
+        if (row.symbol_id_ != current_id)
+        {
+            pass_on_series();
+            current_id = row.symbol_id_;
+        }
+        dates.push_back(FromDateKey(row.date_key_));
+        closes.push_back(row.close_);
+    });
+    pass_on_series();
+
+    registry_ = SymbolRegistry{};
+} // -----  end of method DateCloseGrouper::Finish  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  DateCloseGrouper::SortRows
+//  Description:  LSD radix sort: 8 stable counting passes over the bytes of the date
+//                then one over the symbol ID.  All the byte counts are gathered in a
+//                single pass up front and passes where every row has the same byte
+//                (typically the high bytes of the dates) are skipped.
+// =====================================================================================
+
+void DateCloseGrouper::SortRows(std::vector<Row> &rows)
+{
+    const size_t how_many = rows.size();
+    if (how_many < 2)
+    {
+        return;
+    }
+    scratch_.resize(how_many);
+
+    std::array<std::array<size_t, 256>, sizeof(uint64_t)> byte_counts{};
+    for (const auto &row : rows)
+    {
+        for (size_t b = 0; b < sizeof(uint64_t); ++b)
+        {
+            ++byte_counts[b][(row.date_key_ >> (8 * b)) & 0xFF];
+        }
+    }
+
+    auto *from = &rows;
+    auto *to = &scratch_;
+    for (size_t b = 0; b < sizeof(uint64_t); ++b)
+    {
+        auto &counts = byte_counts[b];
+        if (counts[(rows.front().date_key_ >> (8 * b)) & 0xFF] == how_many)
+        {
+            continue;
+        }
+        size_t next = 0;
+        for (auto &count : counts)
+        {
+            next += std::exchange(count, next);
+        }
+        for (const auto &row : *from)
+        {
+            (*to)[counts[(row.date_key_ >> (8 * b)) & 0xFF]++] = row;
+        }
+        std::swap(from, to);
+    }
+
+    if (registry_.size() > 1)
+    {
+        std::vector<size_t> counts(registry_.size(), 0);
+        for (const auto &row : *from)
+        {
+            ++counts[row.symbol_id_];
+        }
+        size_t next = 0;
+        for (auto &count : counts)
+        {
+            next += std::exchange(count, next);
+        }
+        for (const auto &row : *from)
+        {
+            (*to)[counts[row.symbol_id_]++] = row;
+        }
+        std::swap(from, to);
+    }
+
+    if (from != &rows)
+    {
+        rows.swap(scratch_);
+    }
+} // -----  end of method DateCloseGrouper::SortRows  -----
+
+void DateCloseGrouper::WriteRun()
+{
+    SortRows(rows_);
+
+    auto run_file_name = MakeRunFileName(options_.temporary_directory_);
+    std::ofstream run_file{run_file_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc};
+    if (!run_file.is_open())
+    {
+        throw std::runtime_error(std::format("Can't create temporary sort file: {}.", run_file_name));
+    }
+    run_files_.push_back(run_file_name);
+
+    run_file.write(reinterpret_cast<const char *>(rows_.data()),
+                   static_cast<std::streamsize>(rows_.size() * sizeof(Row)));
+    run_file.close();
+    if (!run_file)
+    {
+        throw std::runtime_error(std::format("Problem writing temporary sort file: {}.", run_file_name));
+    }
+    rows_.clear();
+} // -----  end of method DateCloseGrouper::WriteRun  -----
+
+void DateCloseGrouper::RemoveRunFiles()
+{
+    for (const auto &run_file_name : run_files_)
+    {
+        std::error_code ec;
+        fs::remove(run_file_name, ec);
+    }
+    run_files_.clear();
+} // -----  end of method DateCloseGrouper::RemoveRunFiles  -----
+
+template <typename Func> void DateCloseGrouper::ForEachSortedRow(Func &&func)
+{
+    if (run_files_.empty())
+    {
+        SortRows(rows_);
+        std::ranges::for_each(rows_, func);
+    }
+    else
+    {
+        if (!rows_.empty())
+        {
+            WriteRun();
+        }
+        MergeRuns(func);
+        RemoveRunFiles();
+    }
+    rows_.clear();
+    scratch_.clear();
+    how_many_rows_ = 0;
+} // -----  end of method DateCloseGrouper::ForEachSortedRow  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  DateCloseGrouper::MergeRuns
+//  Description:  k-way merge.  Each run is read a block at a time with the memory
+//                budget shared among the runs.  Ties go to the earlier run so rows
+//                with equal keys stay in the order they were added.
+// =====================================================================================
+
+template <typename Func> void DateCloseGrouper::MergeRuns(Func &&func)
+{
+    struct RunReader
+    {
+        std::ifstream file_;
+        std::vector<Row> block_;
+        size_t next_ = 0;
+
+        // false when the run is used up.
+
+        bool Refill(size_t block_size, const fs::path &file_name)
+        {
+            block_.resize(block_size);
+            file_.read(reinterpret_cast<char *>(block_.data()), static_cast<std::streamsize>(block_size * sizeof(Row)));
+            if (file_.bad())
+            {
+                throw std::runtime_error(std::format("Problem reading temporary sort file: {}.", file_name));
+            }
+            block_.resize(static_cast<size_t>(file_.gcount()) / sizeof(Row));
+            next_ = 0;
+            return !block_.empty();
+        }
+    };
+
+    const size_t block_size = std::max(size_t{1024}, max_rows_in_memory_ / run_files_.size());
+
+    std::vector<RunReader> runs(run_files_.size());
+
+    using HeapEntry = std::pair<Row, size_t>; // the row and which run it came from
+    auto comes_after = [](const HeapEntry &lhs, const HeapEntry &rhs) {
+        return std::tie(lhs.first.symbol_id_, lhs.first.date_key_, lhs.second) >
+               std::tie(rhs.first.symbol_id_, rhs.first.date_key_, rhs.second);
+    };
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, decltype(comes_after)> heap{comes_after};
+
+    for (size_t i = 0; i < runs.size(); ++i)
+    {
+        runs[i].file_.open(run_files_[i], std::ios_base::in | std::ios_base::binary);
+        if (!runs[i].file_.is_open())
+        {
+            throw std::runtime_error(std::format("Can't open temporary sort file: {}.", run_files_[i]));
+        }
+        if (runs[i].Refill(block_size, run_files_[i]))
+        {
+            heap.emplace(runs[i].block_[runs[i].next_++], i);
+        }
+    }
+
+    while (!heap.empty())
+    {
+        const auto [row, which_run] = heap.top();
+        heap.pop();
+        func(row);
+
+        auto &run = runs[which_run];
+        if (run.next_ < run.block_.size() || run.Refill(block_size, run_files_[which_run]))
+        {
+            heap.emplace(run.block_[run.next_++], which_run);
+        }
+    }
+} // -----  end of method DateCloseGrouper::MergeRuns  -----
+
+GroupedDateCloses GroupBySymbol(std::span<const MultiSymbolDateCloseRecord> records, DateCloseGrouperOptions options)
+{
+    DateCloseGrouper grouper{std::move(options)};
+    grouper.Add(records);
+    return grouper.Finish();
+} // -----  end of function GroupBySymbol  -----
@@ -0,0 +1,199 @@
+/* =====================================================================================
+ *
+ * Filename:  decimal_from_chars.cpp
+ *
+ * Description:  Implementation of the fast price to Decimal parser.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 21:52:40
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+
+#include <boost/assert.hpp>
+
+#include "decimal_from_chars.h"
+
+namespace
+{
+// decimal64 holds 16 digits exactly.
+
+constexpr size_t max_fast_digits = 16;
+
+constexpr auto powers_of_10 = [] {
+    std::array<uint64_t, 9> result{};
+    uint64_t power = 1;
+    for (auto &entry : result)
+    {
+        entry = power;
+        power *= 10;
+    }
+    return result;
+}();
+
+// ===  FUNCTION  ======================================================================
+//         Name:  LeadingDigitCount
+//  Description:  how many of the 8 characters in 'chunk', starting from the first
+//                in memory, are digits.  'chunk' is as loaded on a little endian
+//                machine so the first character is the low byte.  A byte is flagged
+//                if subtracting '0' borrows (< '0') or adding 0x46 carries into the
+//                high bit (> '9').  Borrows and carries only move towards later
+//                bytes so the first flagged byte is always right.
+// =====================================================================================
+
+size_t LeadingDigitCount(uint64_t chunk)
+{
+    const uint64_t flags =
+        ((chunk - 0x3030303030303030ULL) | (chunk + 0x4646464646464646ULL)) & 0x8080808080808080ULL;
+    return static_cast<size_t>(std::countr_zero(flags)) / 8;
+}
+
+// ===  FUNCTION  ======================================================================
+//         Name:  EightDigitsToInteger
+//  Description:  8 digit values (0 - 9), first one the most significant and in the low
+//                byte, to an integer: pairs, then quads, then all 8 with 3 multiplies.
+// =====================================================================================
+
+uint32_t EightDigitsToInteger(uint64_t digits)
+{
+    digits = (digits * 10) + (digits >> 8);
+    digits = (((digits & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+              (((digits >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >>
+             32;
+    return static_cast<uint32_t>(digits);
+}
+
+// ===  FUNCTION  ======================================================================
+//         Name:  AccumulateDigits
+//  Description:  add the run of digits starting at 'p' to 'coefficient', moving 'p'
+//                past them.  Up to 8 at a time when there are 8 bytes to load.
+//                Returns false if that would make more than max_fast_digits in all.
+// =====================================================================================
+
+bool AccumulateDigits(const char *&p, const char *last, uint64_t &coefficient, size_t &how_many_digits)
+{
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        while (last - p >= 8)
+        {
+            uint64_t chunk;
+            std::memcpy(&chunk, p, sizeof(chunk));
+            const size_t n = LeadingDigitCount(chunk);
+            if (n == 0)
+            {
+                return true;
+            }
+            how_many_digits += n;
+            if (how_many_digits > max_fast_digits)
+            {
+                return false;
+            }
+
+            // move our digits to the high bytes. The zeros shifted in become leading zeros.
+
+            const uint64_t digits = (chunk - 0x3030303030303030ULL) << (8 * (8 - n));
+            coefficient = coefficient * powers_of_10[n] + EightDigitsToInteger(digits);
+            p += n;
+            if (n < 8)
+            {
+                return true;
+            }
+        }
+    }
+    for (; p != last && *p >= '0' && *p <= '9'; ++p)
+    {
+        if (++how_many_digits > max_fast_digits)
+        {
+            return false;
+        }
+        coefficient = coefficient * 10 + static_cast<uint64_t>(*p - '0');
+    }
+    return true;
+} // -----  end of function AccumulateDigits  -----
+
+std::from_chars_result GeneralDecimalFromChars(const char *first, const char *last, Decimal &value) noexcept
+{
+    const auto [ptr, ec] = bd::from_chars(first, last, value);
+    return {ptr, ec};
+}
+} // namespace
+
+// ===  FUNCTION  ======================================================================
+//         Name:  DecimalFromChars
+//  Description:  we only take the fast path when we are sure to give the same answer
+//                as the general parser, so anything which looks even a little unusual
+//                ('+', '.5', '5.', '5e3', too many digits) goes there instead.
+// =====================================================================================
+
+std::from_chars_result DecimalFromChars(const char *first, const char *last, Decimal &value) noexcept
+{
+    const char *p = first;
+    const bool negative = p != last && *p == '-';
+    if (negative)
+    {
+        ++p;
+    }
+
+    uint64_t coefficient = 0;
+    size_t how_many_digits = 0;
+    if (p == last || *p < '0' || *p > '9' || !AccumulateDigits(p, last, coefficient, how_many_digits))
+    {
+        return GeneralDecimalFromChars(first, last, value);
+    }
+
+    int32_t exponent = 0;
+    if (p != last && *p == '.')
+    {
+        ++p;
+        const size_t integer_digits = how_many_digits;
+        if (p == last || *p < '0' || *p > '9' || !AccumulateDigits(p, last, coefficient, how_many_digits))
+        {
+            return GeneralDecimalFromChars(first, last, value);
+        }
+        exponent = -static_cast<int32_t>(how_many_digits - integer_digits);
+    }
+
+    if (p != last && (*p == 'e' || *p == 'E'))
+    {
+        return GeneralDecimalFromChars(first, last, value);
+    }
+
+    value = Decimal{coefficient, exponent, negative};
+    return {p, std::errc{}};
+} // -----  end of function DecimalFromChars  -----
+
+size_t DecimalFromChars(std::span<const std::string_view> fields, std::span<Decimal> values)
+{
+    BOOST_ASSERT_MSG(values.size() >= fields.size(), "Not enough room for the parsed values.");
+
+    for (size_t i = 0; i < fields.size(); ++i)
+    {
+        if (DecimalFromChars(fields[i], values[i]) != std::errc{})
+        {
+            return i;
+        }
+    }
+    return fields.size();
+} // -----  end of function DecimalFromChars  -----
+
+Decimal StringToDecimal(std::string_view text)
+{
+    Decimal result;
+    if (DecimalFromChars(text, result) != std::errc{})
+    {
+        throw std::runtime_error(std::format("Invalid decimal number: '{}'.", text));
+    }
+    return result;
+} // -----  end of function StringToDecimal  -----
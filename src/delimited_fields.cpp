@@ -0,0 +1,170 @@
+/* =====================================================================================
+ *
+ * Filename:  delimited_fields.cpp
+ *
+ * Description:  Implementation of the lazy delimited text tokenizers.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 23:49:33
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include "delimited_fields.h"
+
+const char *DelimitedFields::FindDelimiter(const char *first, const char *last) const
+{
+    if (delim_.size() == 1)
+    {
+        return char_search::FindChar(first, last, delim_[0]);
+    }
+    const auto pos = std::string_view(first, last - first).find(delim_);
+    return pos == std::string_view::npos ? last : first + pos;
+} // -----  end of method DelimitedFields::FindDelimiter  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  DelimitedFields::NextField
+//  Description:  an unterminated quoted field runs to the end of the record. Anything
+//                between a closing quote and the next delimiter is ignored.
+// =====================================================================================
+
+bool DelimitedFields::NextField(const char *&next, std::string_view &field) const
+{
+    if (next == nullptr)
+    {
+        return false;
+    }
+    const char *last = record_.data() + record_.size();
+    const char *field_end = nullptr;
+
+    if (quoting_ == FieldQuoting::e_RFC4180 && next < last && *next == '"')
+    {
+        const char *content = next + 1;
+        const char *scan = content;
+        for (;;)
+        {
+            const char *quote = char_search::FindChar(scan, last, '"');
+            if (quote + 1 < last && quote[1] == '"')
+            {
+                scan = quote + 2; // doubled quote, keep going
+                continue;
+            }
+            field = std::string_view(content, quote - content);
+            field_end = quote == last ? last : quote + 1;
+            break;
+        }
+    }
+    else
+    {
+        field_end = next;
+    }
+
+    const char *delim = FindDelimiter(field_end, last);
+    if (field_end == next)
+    {
+        field = std::string_view(next, delim - next);
+    }
+    next = delim == last ? nullptr : delim + delim_.size();
+    return true;
+} // -----  end of method DelimitedFields::NextField  -----
+
+std::string_view DelimitedFields::GetField(size_t n) const
+{
+    for (const auto item : *this)
+    {
+        if (n-- == 0)
+        {
+            return item;
+        }
+    }
+    return {};
+} // -----  end of method DelimitedFields::GetField  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  DelimitedLines::NextLine
+//  Description:  when quoting, an odd number of quotes so far means we are inside a
+//                quoted field so the newline we found doesn't count.
+// =====================================================================================
+
+bool DelimitedLines::NextLine(const char *&next, std::string_view &line) const
+{
+    const char *last = buffer_.data() + buffer_.size();
+    if (next == nullptr || next >= last)
+    {
+        return false;
+    }
+
+    const char *scan = next;
+    const char *eol = nullptr;
+    size_t quotes = 0;
+    for (;;)
+    {
+        eol = char_search::FindChar(scan, last, '\n');
+        if (quoting_ == FieldQuoting::e_RFC4180 && eol != last)
+        {
+            quotes += char_search::CountChar(scan, eol, '"');
+            if (quotes % 2 != 0)
+            {
+                scan = eol + 1;
+                continue;
+            }
+        }
+        break;
+    }
+
+    const char *line_end = eol;
+    if (line_end > next && line_end[-1] == '\r')
+    {
+        --line_end;
+    }
+    line = std::string_view(next, line_end - next);
+    next = eol == last ? last : eol + 1;
+    return true;
+} // -----  end of method DelimitedLines::NextLine  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  select_fields
+//  Description:  stops once the highest selected column has been seen.
+// =====================================================================================
+
+size_t select_fields(const DelimitedFields &fields, uint64_t column_mask, std::span<std::string_view> results)
+{
+    size_t how_many = 0;
+    if (column_mask == 0 || results.empty())
+    {
+        return how_many;
+    }
+    for (const auto item : fields)
+    {
+        if ((column_mask & 1) != 0)
+        {
+            results[how_many++] = item;
+        }
+        column_mask >>= 1;
+        if (column_mask == 0 || how_many == results.size())
+        {
+            break;
+        }
+    }
+    return how_many;
+} // -----  end of function select_fields  -----
+
+std::string UnquoteField(std::string_view field)
+{
+    std::string result;
+    result.reserve(field.size());
+    for (size_t i = 0; i < field.size(); ++i)
+    {
+        result += field[i];
+        if (field[i] == '"' && i + 1 < field.size() && field[i + 1] == '"')
+        {
+            ++i;
+        }
+    }
+    return result;
+} // -----  end of function UnquoteField  -----
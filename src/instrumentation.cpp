@@ -0,0 +1,423 @@
+/* =====================================================================================
+ *
+ * Filename:  instrumentation.cpp
+ *
+ * Description:  Implementation of the instrumentation metrics and their dumps.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 13:52:09
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <boost/assert.hpp>
+
+#include "instrumentation.h"
+
+namespace
+{
+using namespace instrumentation;
+
+// room for this many distinct metrics. We only have a handful.
+
+constexpr size_t max_metrics = 256;
+
+struct MetricInfo
+{
+    std::string name_;
+    MetricKind kind_;
+    std::string work_unit_;
+};
+
+// one thread's numbers for one metric. Only the owning thread writes so plain
+// load + store is enough; the atomics are there so a snapshot can read safely.
+// Counters have no use for the buckets so only timers and histograms get them.
+
+struct MetricSlot
+{
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> total_{0};
+    std::atomic<uint64_t> min_{std::numeric_limits<uint64_t>::max()};
+    std::atomic<uint64_t> max_{0};
+    std::atomic<uint64_t> work_{0};
+    std::unique_ptr<std::array<std::atomic<uint64_t>, HistogramBuckets>> buckets_;
+
+    explicit MetricSlot(MetricKind kind)
+    {
+        if (kind != MetricKind::e_Counter)
+        {
+            buckets_ = std::make_unique<std::array<std::atomic<uint64_t>, HistogramBuckets>>();
+        }
+    }
+
+    void Add(uint64_t value, uint64_t work)
+    {
+        const auto bump = [](std::atomic<uint64_t> &a, uint64_t amount) {
+            a.store(a.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        };
+        bump(count_, 1);
+        bump(total_, value);
+        bump(work_, work);
+        if (buckets_)
+        {
+            bump((*buckets_)[std::min<size_t>(std::bit_width(value), HistogramBuckets - 1)], 1);
+        }
+        if (value < min_.load(std::memory_order_relaxed))
+        {
+            min_.store(value, std::memory_order_relaxed);
+        }
+        if (value > max_.load(std::memory_order_relaxed))
+        {
+            max_.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    void AddTo(MetricSnapshot &snapshot) const
+    {
+        const auto count = count_.load(std::memory_order_relaxed);
+        if (count == 0)
+        {
+            return;
+        }
+        snapshot.min_ = snapshot.count_ == 0 ? min_.load(std::memory_order_relaxed)
+                                             : std::min(snapshot.min_, min_.load(std::memory_order_relaxed));
+        snapshot.max_ = std::max(snapshot.max_, max_.load(std::memory_order_relaxed));
+        snapshot.count_ += count;
+        snapshot.total_ += total_.load(std::memory_order_relaxed);
+        snapshot.work_ += work_.load(std::memory_order_relaxed);
+        if (buckets_)
+        {
+            for (size_t i = 0; i < HistogramBuckets; ++i)
+            {
+                snapshot.buckets_[i] += (*buckets_)[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void Reset()
+    {
+        count_.store(0, std::memory_order_relaxed);
+        total_.store(0, std::memory_order_relaxed);
+        min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+        work_.store(0, std::memory_order_relaxed);
+        if (buckets_)
+        {
+            for (auto &bucket : *buckets_)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+struct ThreadMetrics;
+
+// everything shared between threads. Only touched when a metric is registered,
+// a thread starts or ends or someone takes a snapshot.
+
+struct MetricRegistry
+{
+    std::mutex mutex_;
+    std::vector<MetricInfo> metrics_;
+    std::vector<ThreadMetrics *> live_threads_;
+    std::vector<MetricSnapshot> retired_; // from threads which have exited
+
+    static MetricRegistry &Get()
+    {
+        static MetricRegistry registry;
+        return registry;
+    }
+};
+
+// a thread only has slots for the metrics it has recorded, indexed by metric ID.
+// Only the owning thread changes slots_ and only with the registry locked, so it
+// can read slots_ without the lock and snapshots can read it with the lock.
+// The slots themselves never move.
+
+struct ThreadMetrics
+{
+    std::vector<std::unique_ptr<MetricSlot>> slots_;
+
+    ThreadMetrics()
+    {
+        auto &registry = MetricRegistry::Get();
+        const std::lock_guard<std::mutex> lock{registry.mutex_};
+        registry.live_threads_.push_back(this);
+    }
+
+    // keep what this thread recorded after it's gone.
+
+    ~ThreadMetrics()
+    {
+        auto &registry = MetricRegistry::Get();
+        const std::lock_guard<std::mutex> lock{registry.mutex_};
+        registry.retired_.resize(registry.metrics_.size());
+        for (size_t i = 0; i < slots_.size(); ++i)
+        {
+            if (slots_[i])
+            {
+                slots_[i]->AddTo(registry.retired_[i]);
+            }
+        }
+        std::erase(registry.live_threads_, this);
+    }
+
+    // the first time this thread records metric 'id'.
+
+    MetricSlot &AddSlot(MetricID id)
+    {
+        auto &registry = MetricRegistry::Get();
+        const std::lock_guard<std::mutex> lock{registry.mutex_};
+        BOOST_ASSERT_MSG(id < registry.metrics_.size(), std::format("Unknown metric ID: {}.", id).c_str());
+        if (slots_.size() <= id)
+        {
+            slots_.resize(id + 1);
+        }
+        slots_[id] = std::make_unique<MetricSlot>(registry.metrics_[id].kind_);
+        return *slots_[id];
+    }
+};
+
+ThreadMetrics &GetThreadMetrics()
+{
+    thread_local ThreadMetrics metrics;
+    return metrics;
+}
+
+std::string PrometheusName(std::string_view prefix, std::string_view name)
+{
+    std::string result{prefix};
+    std::ranges::transform(name, std::back_inserter(result), [](char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ? c : '_';
+    });
+    return result;
+}
+
+std::string_view MetricKindName(MetricKind kind)
+{
+    switch (kind)
+    {
+        case MetricKind::e_Timer:
+            return "timer";
+        case MetricKind::e_Counter:
+            return "counter";
+        case MetricKind::e_Histogram:
+            return "histogram";
+    }
+    return "unknown";
+}
+
+// the largest value bucket i holds: 2^i - 1, and everything for the last bucket.
+// Prometheus 'le' bounds are inclusive so this is what we export.
+
+uint64_t BucketUpperBound(size_t i)
+{
+    return i >= HistogramBuckets - 1 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << i) - 1;
+}
+} // namespace
+
+namespace instrumentation
+{
+MetricID RegisterMetric(std::string_view name, MetricKind kind, std::string_view work_unit)
+{
+    auto &registry = MetricRegistry::Get();
+    const std::lock_guard<std::mutex> lock{registry.mutex_};
+    if (auto found = std::ranges::find(registry.metrics_, name, &MetricInfo::name_); found != registry.metrics_.end())
+    {
+        return static_cast<MetricID>(found - registry.metrics_.begin());
+    }
+    if (registry.metrics_.size() >= max_metrics)
+    {
+        throw std::runtime_error(
+            std::format("Can't register metric: {}. Too many metrics. Limit is: {}.", name, max_metrics));
+    }
+    registry.metrics_.push_back({std::string{name}, kind, std::string{work_unit}});
+    return static_cast<MetricID>(registry.metrics_.size() - 1);
+} // -----  end of function RegisterMetric  -----
+
+void Record(MetricID id, uint64_t value, uint64_t work)
+{
+    auto &metrics = GetThreadMetrics();
+    auto &slot = id < metrics.slots_.size() && metrics.slots_[id] ? *metrics.slots_[id] : metrics.AddSlot(id);
+    slot.Add(value, work);
+} // -----  end of function Record  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  ClockTicksToNanoseconds
+//  Description:  the TSC rate is measured once, over a short sleep, the first time
+//                we need it.
+// =====================================================================================
+
+uint64_t ClockTicksToNanoseconds(uint64_t ticks)
+{
+#if defined(COMMON_UTILITIES_INSTRUMENTATION_RDTSC) && (defined(__x86_64__) || defined(__i386__))
+    static const double nanoseconds_per_tick = [] {
+        const auto start_time = std::chrono::steady_clock::now();
+        const auto start_ticks = ReadClock();
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        const auto elapsed_ticks = ReadClock() - start_ticks;
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time);
+        return static_cast<double>(elapsed.count()) / static_cast<double>(elapsed_ticks);
+    }();
+    return static_cast<uint64_t>(static_cast<double>(ticks) * nanoseconds_per_tick);
+#else
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::duration{ticks}).count());
+#endif
+} // -----  end of function ClockTicksToNanoseconds  -----
+
+std::vector<MetricSnapshot> TakeSnapshot()
+{
+    auto &registry = MetricRegistry::Get();
+    const std::lock_guard<std::mutex> lock{registry.mutex_};
+
+    std::vector<MetricSnapshot> snapshot(registry.metrics_.size());
+    for (size_t i = 0; i < registry.metrics_.size(); ++i)
+    {
+        auto &metric = snapshot[i];
+        if (i < registry.retired_.size())
+        {
+            metric = registry.retired_[i];
+        }
+        metric.name_ = registry.metrics_[i].name_;
+        metric.kind_ = registry.metrics_[i].kind_;
+        metric.work_unit_ = registry.metrics_[i].work_unit_;
+        for (const auto *thread : registry.live_threads_)
+        {
+            if (i < thread->slots_.size() && thread->slots_[i])
+            {
+                thread->slots_[i]->AddTo(metric);
+            }
+        }
+    }
+    return snapshot;
+} // -----  end of function TakeSnapshot  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  ResetMetrics
+//  Description:  a recording that races with this may survive the reset. That's fine
+//                for our purposes.
+// =====================================================================================
+
+void ResetMetrics()
+{
+    auto &registry = MetricRegistry::Get();
+    const std::lock_guard<std::mutex> lock{registry.mutex_};
+    registry.retired_.clear();
+    for (auto *thread : registry.live_threads_)
+    {
+        for (auto &slot : thread->slots_)
+        {
+            if (slot)
+            {
+                slot->Reset();
+            }
+        }
+    }
+} // -----  end of function ResetMetrics  -----
+
+Json::Value SnapshotToJSON(const std::vector<MetricSnapshot> &snapshot)
+{
+    Json::Value result{Json::arrayValue};
+    for (const auto &metric : snapshot)
+    {
+        Json::Value entry;
+        entry["name"] = metric.name_;
+        entry["kind"] = std::string{MetricKindName(metric.kind_)};
+        entry["count"] = Json::UInt64{metric.count_};
+        entry["total"] = Json::UInt64{metric.total_};
+        entry["min"] = Json::UInt64{metric.count_ == 0 ? 0 : metric.min_};
+        entry["max"] = Json::UInt64{metric.max_};
+        if (metric.kind_ == MetricKind::e_Timer)
+        {
+            entry["unit"] = "ns";
+            if (!metric.work_unit_.empty())
+            {
+                entry["work_unit"] = metric.work_unit_;
+                entry["work"] = Json::UInt64{metric.work_};
+                entry["work_per_second"] = metric.WorkPerSecond();
+            }
+        }
+        Json::Value buckets{Json::arrayValue};
+        for (size_t i = 0; i < HistogramBuckets; ++i)
+        {
+            if (metric.buckets_[i] != 0)
+            {
+                Json::Value bucket;
+                bucket["le"] = Json::UInt64{BucketUpperBound(i)};
+                bucket["count"] = Json::UInt64{metric.buckets_[i]};
+                buckets.append(bucket);
+            }
+        }
+        entry["buckets"] = buckets;
+        result.append(entry);
+    }
+    return result;
+} // -----  end of function SnapshotToJSON  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  SnapshotToPrometheus
+//  Description:  timers become histograms in seconds (with a separate work counter),
+//                counters become counters and histograms stay histograms.
+// =====================================================================================
+
+std::string SnapshotToPrometheus(const std::vector<MetricSnapshot> &snapshot, std::string_view prefix)
+{
+    std::string result;
+    auto out = std::back_inserter(result);
+    for (const auto &metric : snapshot)
+    {
+        const auto name = PrometheusName(prefix, metric.name_);
+        if (metric.kind_ == MetricKind::e_Counter)
+        {
+            std::format_to(out, "# TYPE {0}_total counter\n{0}_total {1}\n", name, metric.total_);
+            continue;
+        }
+
+        const bool is_timer = metric.kind_ == MetricKind::e_Timer;
+        const auto histogram_name = is_timer ? name + "_seconds" : name;
+        const auto scale = is_timer ? 1e-9 : 1.0;
+
+        std::format_to(out, "# TYPE {} histogram\n", histogram_name);
+        const auto last_bucket = std::distance(
+            std::ranges::find_if(metric.buckets_ | std::views::reverse, [](uint64_t n) { return n != 0; }),
+            metric.buckets_.rend());
+        uint64_t cumulative = 0;
+        for (size_t i = 0; std::cmp_less(i, last_bucket); ++i)
+        {
+            cumulative += metric.buckets_[i];
+            std::format_to(out, "{}_bucket{{le=\"{}\"}} {}\n", histogram_name,
+                           static_cast<double>(BucketUpperBound(i)) * scale, cumulative);
+        }
+        std::format_to(out, "{0}_bucket{{le=\"+Inf\"}} {1}\n{0}_sum {2}\n{0}_count {1}\n", histogram_name,
+                       metric.count_, static_cast<double>(metric.total_) * scale);
+
+        if (is_timer && !metric.work_unit_.empty())
+        {
+            const auto work_name = std::format("{}_{}_total", name, PrometheusName("", metric.work_unit_));
+            std::format_to(out, "# TYPE {0} counter\n{0} {1}\n", work_name, metric.work_);
+        }
+    }
+    return result;
+} // -----  end of function SnapshotToPrometheus  -----
+
+} // namespace instrumentation
@@ -0,0 +1,120 @@
+/* =====================================================================================
+ *
+ * Filename:  mapped_file.cpp
+ *
+ * Description:  Implementation of read-only memory mapped file wrapper.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 11:04:51
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/assert.hpp>
+
+#include "mapped_file.h"
+
+// ===  FUNCTION  ======================================================================
+//         Name:  MappedFile::MappedFile
+//  Description:  the file descriptor is only needed until the mapping is made.
+// =====================================================================================
+
+MappedFile::MappedFile(const fs::path &file_name, MappedFileAccess access)
+{
+    const int fd = ::open(file_name.c_str(), O_RDONLY | O_CLOEXEC);
+    BOOST_ASSERT_MSG(fd >= 0, std::format("Can't open data file: {}.", file_name.string()).c_str());
+
+    struct stat file_info{};
+    if (::fstat(fd, &file_info) != 0)
+    {
+        const int error = errno;
+        ::close(fd);
+        throw std::runtime_error(std::format("Unable to stat file: {}. {}", file_name.string(), std::strerror(error)));
+    }
+
+    // mmap won't take a zero length so an empty file just stays unmapped.
+
+    if (file_info.st_size > 0)
+    {
+        const auto file_size = static_cast<size_t>(file_info.st_size);
+        void *mapping = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw std::runtime_error(
+                std::format("Unable to memory map file: {}. {}", file_name.string(), std::strerror(error)));
+        }
+        data_ = static_cast<const char *>(mapping);
+        size_ = file_size;
+
+        // these are only hints so we don't care if the kernel declines them.
+
+        switch (access)
+        {
+            using enum MappedFileAccess;
+            case e_Sequential:
+                ::madvise(mapping, size_, MADV_SEQUENTIAL);
+                break;
+
+            case e_SequentialHugePages:
+                ::madvise(mapping, size_, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+                ::madvise(mapping, size_, MADV_HUGEPAGE);
+#endif
+                break;
+
+            case e_Random:
+                ::madvise(mapping, size_, MADV_RANDOM);
+                break;
+        };
+    }
+    ::close(fd);
+} // -----  end of method MappedFile::MappedFile  -----
+
+MappedFile::MappedFile(MappedFile &&rhs) noexcept
+    : data_{std::exchange(rhs.data_, nullptr)}, size_{std::exchange(rhs.size_, 0)}
+{
+} // -----  end of method MappedFile::MappedFile  -----
+
+MappedFile::~MappedFile()
+{
+    Unmap();
+} // -----  end of method MappedFile::~MappedFile  -----
+
+MappedFile &MappedFile::operator=(MappedFile &&rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        Unmap();
+        data_ = std::exchange(rhs.data_, nullptr);
+        size_ = std::exchange(rhs.size_, 0);
+    }
+    return *this;
+} // -----  end of method MappedFile::operator=  -----
+
+void MappedFile::Unmap()
+{
+    if (data_ != nullptr)
+    {
+        ::munmap(const_cast<char *>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+} // -----  end of method MappedFile::Unmap  -----
@@ -0,0 +1,96 @@
+/* =====================================================================================
+ *
+ * Filename:  market_session_clock.cpp
+ *
+ * Description:  Implementation of cached US market session clock.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 17:21:48
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include "market_session_clock.h"
+
+MarketSessionClock::MarketSessionClock(std::string_view local_time_zone_name, const TradingCalendar &calendar)
+    : local_zone_{std::chrono::locate_zone(local_time_zone_name)}, calendar_{&calendar}
+{
+} // -----  end of method MarketSessionClock::MarketSessionClock  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  MarketSessionClock::GetStatus
+//  Description:  same answers as GetUS_MarketStatus.
+// =====================================================================================
+
+US_MarketStatus MarketSessionClock::GetStatus(std::chrono::sys_seconds now)
+{
+    UpdateSession(now);
+
+    if (!is_trading_day_)
+    {
+        return US_MarketStatus::e_NonTradingDay;
+    }
+    if (now < market_open_)
+    {
+        return US_MarketStatus::e_NotOpenYet;
+    }
+    if (now > market_close_)
+    {
+        return US_MarketStatus::e_ClosedForDay;
+    }
+    return US_MarketStatus::e_OpenForTrading;
+} // -----  end of method MarketSessionClock::GetStatus  -----
+
+std::chrono::seconds MarketSessionClock::SecondsUntilOpen(std::chrono::sys_seconds now)
+{
+    switch (GetStatus(now))
+    {
+        using enum US_MarketStatus;
+        case e_OpenForTrading:
+            return std::chrono::seconds{0};
+
+        case e_NotOpenYet:
+            return market_open_ - now;
+
+        case e_ClosedForDay:
+        case e_NonTradingDay:
+            return next_market_open_ - now;
+    };
+    return std::chrono::seconds{0};
+} // -----  end of method MarketSessionClock::SecondsUntilOpen  -----
+
+std::chrono::seconds MarketSessionClock::SecondsUntilClose(std::chrono::sys_seconds now)
+{
+    if (GetStatus(now) != US_MarketStatus::e_OpenForTrading)
+    {
+        return std::chrono::seconds{0};
+    }
+    return market_close_ - now;
+} // -----  end of method MarketSessionClock::SecondsUntilClose  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  MarketSessionClock::StartNewDay
+//  Description:  figure out which day it is in New York and cache that day's session.
+// =====================================================================================
+
+void MarketSessionClock::StartNewDay(std::chrono::sys_seconds now)
+{
+    const auto *us_zone = GetUS_MarketTimeZone();
+
+    const auto today_in_US = std::chrono::floor<std::chrono::days>(us_zone->to_local(now));
+    day_begin_ = us_zone->to_sys(today_in_US, std::chrono::choose::earliest);
+    day_end_ = us_zone->to_sys(today_in_US + std::chrono::days{1}, std::chrono::choose::earliest);
+
+    const std::chrono::year_month_day today{today_in_US};
+    is_trading_day_ = calendar_->IsTradingDay(today);
+    market_open_ = GetUS_MarketOpenTime(today).get_sys_time();
+    market_close_ = GetUS_MarketCloseTime(today).get_sys_time();
+
+    const auto next_trading_day = calendar_->AddBusinessDays(today, 1);
+    next_market_open_ = GetUS_MarketOpenTime(next_trading_day).get_sys_time();
+} // -----  end of method MarketSessionClock::StartNewDay  -----
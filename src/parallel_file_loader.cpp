@@ -0,0 +1,153 @@
+/* =====================================================================================
+ *
+ * Filename:  parallel_file_loader.cpp
+ *
+ * Description:  Implementation of parallel JSON file loading.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 22:04:41
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <format>
+#include <mutex>
+#include <semaphore>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "mapped_file.h"
+#include "parallel_file_loader.h"
+#include "utilities.h"
+
+namespace
+{
+// same steps as ReadAndParsePF_ChartJSONFile but nothing escapes -- a worker thread
+// has no one to throw to.
+
+LoadedJSONFile LoadOneJSONFile(const fs::path &file_name)
+{
+    LoadedJSONFile result{.file_name_ = file_name};
+    try
+    {
+        std::error_code ec;
+        const auto status = fs::status(file_name, ec);
+        if (ec || !fs::exists(status))
+        {
+            result.error_ = std::format("Unable to find JSON file: {}", file_name);
+        }
+        else if (fs::is_regular_file(status))
+        {
+            const MappedFile mapped_file{file_name};
+            result.data_ = ParseJSONData(mapped_file.AsStringView());
+        }
+        else
+        {
+            result.data_ = ParseJSONData(LoadDataFileForUse(file_name));
+        }
+    }
+    catch (const std::exception &e)
+    {
+        result.data_ = Json::Value{};
+        result.error_ = std::format("Problem loading JSON file: {}: {}", file_name, e.what());
+    }
+    return result;
+}
+} // namespace
+
+// ===  FUNCTION  ======================================================================
+//         Name:  LoadJSONFilesInParallel
+//  Description:  each worker takes a permit from 'in_flight' before it loads a file and
+//                the permit only comes back once the caller has finished with that
+//                file.  So at most max_files_in_flight_ parsed files exist at a time no
+//                matter how far the workers get ahead of the caller.
+// =====================================================================================
+
+size_t LoadJSONFilesInParallel(std::span<const fs::path> file_names, const LoadedJSONFileHandler &on_loaded,
+                               const ParallelLoadOptions &options)
+{
+    if (file_names.empty())
+    {
+        return 0;
+    }
+    const uint32_t thread_count = static_cast<uint32_t>(
+        std::min<size_t>(options.thread_count_ != 0 ? options.thread_count_
+                                                    : std::max(1U, std::thread::hardware_concurrency()),
+                         file_names.size()));
+    const uint32_t max_in_flight =
+        options.max_files_in_flight_ != 0 ? options.max_files_in_flight_ : 2 * thread_count;
+
+    std::counting_semaphore<> in_flight{static_cast<ptrdiff_t>(max_in_flight)};
+    std::atomic<size_t> next_file{0};
+    std::atomic<bool> cancelled{false};
+
+    std::mutex completed_mutex;
+    std::condition_variable completed_cv;
+    std::deque<LoadedJSONFile> completed;
+
+    auto worker = [&]() {
+        for (;;)
+        {
+            in_flight.acquire();
+            const auto which = next_file.fetch_add(1, std::memory_order_relaxed);
+            if (which >= file_names.size() || cancelled.load(std::memory_order_relaxed))
+            {
+                in_flight.release();
+                return;
+            }
+            auto loaded = LoadOneJSONFile(file_names[which]);
+            {
+                const std::lock_guard<std::mutex> lock{completed_mutex};
+                completed.push_back(std::move(loaded));
+            }
+            completed_cv.notify_one();
+        }
+    };
+
+    // declared last so the threads are joined before anything they use goes away.
+
+    std::vector<std::jthread> workers;
+    workers.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; ++i)
+    {
+        workers.emplace_back(worker);
+    }
+
+    size_t loaded_ok = 0;
+    try
+    {
+        for (size_t received = 0; received < file_names.size(); ++received)
+        {
+            LoadedJSONFile loaded;
+            {
+                std::unique_lock<std::mutex> lock{completed_mutex};
+                completed_cv.wait(lock, [&completed] { return !completed.empty(); });
+                loaded = std::move(completed.front());
+                completed.pop_front();
+            }
+            loaded_ok += loaded.IsOK() ? 1 : 0;
+            on_loaded(std::move(loaded));
+            in_flight.release();
+        }
+    }
+    catch (...)
+    {
+        // the handler threw. Wake up any worker waiting for a permit so it can see
+        // we're done and the joins don't hang.
+
+        cancelled.store(true, std::memory_order_relaxed);
+        in_flight.release(thread_count);
+        throw;
+    }
+    return loaded_ok;
+} // -----  end of function LoadJSONFilesInParallel  -----
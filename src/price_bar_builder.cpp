@@ -0,0 +1,161 @@
+/* =====================================================================================
+ *
+ * Filename:  price_bar_builder.cpp
+ *
+ * Description:  Implementation of the incremental time bar builder.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 15:20:11
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <format>
+
+#include <boost/assert.hpp>
+
+#include "price_bar_builder.h"
+
+PriceBarBuilder::PriceBarBuilder(std::span<const std::chrono::seconds> bar_widths, PriceBarHandler on_bar_completed)
+    : on_bar_completed_{std::move(on_bar_completed)}
+{
+    BOOST_ASSERT_MSG(!bar_widths.empty(), "PriceBarBuilder needs at least 1 bar width.");
+    bar_widths_.reserve(bar_widths.size());
+    for (const auto width : bar_widths)
+    {
+        BOOST_ASSERT_MSG(width.count() > 0, std::format("Invalid bar width: {}", width).c_str());
+        bar_widths_.push_back(width.count());
+    }
+} // -----  end of method PriceBarBuilder::PriceBarBuilder  -----
+
+const PriceBar *PriceBarBuilder::GetCurrentBar(SymbolID id, size_t which_width) const
+{
+    BOOST_ASSERT_MSG(which_width < bar_widths_.size(),
+                     std::format("Bar width index: {} out of range: {}", which_width, bar_widths_.size()).c_str());
+    const size_t slot = id * bar_widths_.size() + which_width;
+    if (slot >= bars_.size() || bars_[slot].tick_count_ == 0)
+    {
+        return nullptr;
+    }
+    return &bars_[slot];
+} // -----  end of method PriceBarBuilder::GetCurrentBar  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  PriceBarBuilder::AddTick
+//  Description:  for each width, work out which bar the tick belongs in. If that's
+//                after the current bar, the current bar is done.
+// =====================================================================================
+
+void PriceBarBuilder::AddTick(SymbolID id, int64_t timestamp_seconds, double price)
+{
+    const size_t first_slot = id * bar_widths_.size();
+    if (first_slot >= bars_.size())
+    {
+        bars_.resize(first_slot + bar_widths_.size());
+    }
+
+    const auto since_open = timestamp_seconds - GetMarketOpen(timestamp_seconds);
+
+    for (size_t i = 0; i < bar_widths_.size(); ++i)
+    {
+        const auto width = bar_widths_[i];
+        auto &bar = bars_[first_slot + i];
+
+        // round down, also for ticks before the open.
+
+        auto offset = since_open % width;
+        if (offset < 0)
+        {
+            offset += width;
+        }
+        const auto bar_start = timestamp_seconds - offset;
+
+        if (bar.tick_count_ != 0 && bar_start > bar.start_seconds_)
+        {
+            if (on_bar_completed_)
+            {
+                on_bar_completed_(id, bar);
+            }
+            bar.tick_count_ = 0;
+        }
+
+        if (bar.tick_count_ == 0)
+        {
+            bar = {.start_seconds_ = bar_start,
+                   .width_seconds_ = width,
+                   .open_ = price,
+                   .high_ = price,
+                   .low_ = price,
+                   .close_ = price,
+                   .tick_count_ = 1};
+            continue;
+        }
+        bar.high_ = std::max(bar.high_, price);
+        bar.low_ = std::min(bar.low_, price);
+        bar.close_ = price;
+        ++bar.tick_count_;
+    }
+} // -----  end of method PriceBarBuilder::AddTick  -----
+
+void PriceBarBuilder::AddTicks(SymbolID id, std::span<const int64_t> timestamp_seconds,
+                               std::span<const double> prices)
+{
+    BOOST_ASSERT_MSG(timestamp_seconds.size() == prices.size(),
+                     std::format("Have: {} timestamps but: {} prices.", timestamp_seconds.size(), prices.size())
+                         .c_str());
+    for (size_t i = 0; i < prices.size(); ++i)
+    {
+        AddTick(id, timestamp_seconds[i], prices[i]);
+    }
+} // -----  end of method PriceBarBuilder::AddTicks  -----
+
+void PriceBarBuilder::Flush(SymbolID id)
+{
+    const size_t first_slot = id * bar_widths_.size();
+    if (first_slot >= bars_.size())
+    {
+        return;
+    }
+    for (size_t i = 0; i < bar_widths_.size(); ++i)
+    {
+        auto &bar = bars_[first_slot + i];
+        if (bar.tick_count_ != 0 && on_bar_completed_)
+        {
+            on_bar_completed_(id, bar);
+        }
+        bar.tick_count_ = 0;
+    }
+} // -----  end of method PriceBarBuilder::Flush  -----
+
+void PriceBarBuilder::FlushAll()
+{
+    const auto how_many_symbols = static_cast<SymbolID>(bars_.size() / bar_widths_.size());
+    for (SymbolID id = 0; id < how_many_symbols; ++id)
+    {
+        Flush(id);
+    }
+} // -----  end of method PriceBarBuilder::FlushAll  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  PriceBarBuilder::StartNewDay
+//  Description:  same day logic as MarketSessionClock::StartNewDay.
+// =====================================================================================
+
+void PriceBarBuilder::StartNewDay(int64_t timestamp_seconds)
+{
+    const auto *us_zone = GetUS_MarketTimeZone();
+
+    const std::chrono::sys_seconds now{std::chrono::seconds{timestamp_seconds}};
+    const auto today_in_US = std::chrono::floor<std::chrono::days>(us_zone->to_local(now));
+    day_begin_ = us_zone->to_sys(today_in_US, std::chrono::choose::earliest).time_since_epoch().count();
+    day_end_ =
+        us_zone->to_sys(today_in_US + std::chrono::days{1}, std::chrono::choose::earliest).time_since_epoch().count();
+    market_open_ =
+        GetUS_MarketOpenTime(std::chrono::year_month_day{today_in_US}).get_sys_time().time_since_epoch().count();
+} // -----  end of method PriceBarBuilder::StartNewDay  -----
@@ -0,0 +1,96 @@
+/* =====================================================================================
+ *
+ * Filename:  price_history_columns.cpp
+ *
+ * Description:  Implementation of column oriented price history storage.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 14:52:30
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+
+#include "decimal_from_chars.h"
+#include "price_history_columns.h"
+#include "price_history_reader.h"
+
+void PriceHistoryColumns::reserve(size_t how_many)
+{
+    date_.reserve(how_many);
+    open_.reserve(how_many);
+    high_.reserve(how_many);
+    low_.reserve(how_many);
+    close_.reserve(how_many);
+} // -----  end of method PriceHistoryColumns::reserve  -----
+
+void PriceHistoryColumns::AddRow(std::chrono::sys_days date, Decimal open, Decimal high, Decimal low, Decimal close)
+{
+    date_.push_back(date);
+    open_.push_back(open);
+    high_.push_back(high);
+    low_.push_back(low);
+    close_.push_back(close);
+} // -----  end of method PriceHistoryColumns::AddRow  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  ConvertJSONPriceHistoryToColumns
+//  Description:  Expects the input data is in descending order by date.
+//                Tiingo dates have a time part which we drop.
+// =====================================================================================
+
+PriceHistoryColumns ConvertJSONPriceHistoryToColumns(const std::string &symbol, const Json::Value &the_data,
+                                                     uint32_t how_many_days, UseAdjusted use_adjusted)
+{
+    PriceHistoryColumns history{symbol};
+    if (!the_data.isArray() || the_data.empty())
+    {
+        return history;
+    }
+
+    const auto how_many = std::min(how_many_days, the_data.size());
+    history.reserve(how_many);
+
+    const bool adjusted = use_adjusted == UseAdjusted::e_Yes;
+    const char *open_key = adjusted ? "adjOpen" : "open";
+    const char *high_key = adjusted ? "adjHigh" : "high";
+    const char *low_key = adjusted ? "adjLow" : "low";
+    const char *close_key = adjusted ? "adjClose" : "close";
+
+    for (Json::ArrayIndex i = 0; i < how_many; ++i)
+    {
+        const auto &row = the_data[i];
+        const std::string_view date{row["date"].asCString()};
+        history.AddRow(std::chrono::sys_days{StringToDateYMD("%Y-%m-%d", date.substr(0, 10))},
+                       StringToDecimal(row[open_key].asCString()), StringToDecimal(row[high_key].asCString()),
+                       StringToDecimal(row[low_key].asCString()), StringToDecimal(row[close_key].asCString()));
+    }
+    return history;
+} // -----  end of function ConvertJSONPriceHistoryToColumns  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  ParseJSONPriceHistoryToColumns
+//  Description:
+// =====================================================================================
+
+PriceHistoryColumns ParseJSONPriceHistoryToColumns(const std::string &symbol, std::string_view json_text,
+                                                   uint32_t how_many_days, UseAdjusted use_adjusted)
+{
+    PriceHistoryColumns history{symbol};
+
+    PriceHistoryJSONReader reader{json_text, use_adjusted};
+    PriceHistoryJSONRow row;
+    while (history.size() < how_many_days && reader.NextRow(row))
+    {
+        history.AddRow(std::chrono::sys_days{StringToDateYMD("%Y-%m-%d", row.date_.substr(0, 10))},
+                       reader.FieldToDecimal(row.open_), reader.FieldToDecimal(row.high_),
+                       reader.FieldToDecimal(row.low_), reader.FieldToDecimal(row.close_));
+    }
+    return history;
+} // -----  end of function ParseJSONPriceHistoryToColumns  -----
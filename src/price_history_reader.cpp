@@ -0,0 +1,290 @@
+/* =====================================================================================
+ *
+ * Filename:  price_history_reader.cpp
+ *
+ * Description:  Implementation of pull style Tiingo price history reader.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 13:31:09
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
+#include "decimal_from_chars.h"
+#include "price_history_reader.h"
+
+// ===  FUNCTION  ======================================================================
+//         Name:  PriceHistoryJSONReader::PriceHistoryJSONReader
+//  Description:  we resolve which price fields we want once, up front.
+// =====================================================================================
+
+PriceHistoryJSONReader::PriceHistoryJSONReader(std::string_view json_text, UseAdjusted use_adjusted)
+    : json_text_{json_text}
+{
+    if (use_adjusted == UseAdjusted::e_Yes)
+    {
+        price_keys_ = {"adjOpen", "adjHigh", "adjLow", "adjClose"};
+    }
+    else
+    {
+        price_keys_ = {"open", "high", "low", "close"};
+    }
+
+    // anything other than an array means there is no price history to read.
+
+    SkipWhitespace();
+    if (pos_ == json_text_.size() || json_text_[pos_] != '[')
+    {
+        finished_ = true;
+        return;
+    }
+    ++pos_;
+    SkipWhitespace();
+    if (pos_ < json_text_.size() && json_text_[pos_] == ']')
+    {
+        ++pos_;
+        finished_ = true;
+    }
+} // -----  end of method PriceHistoryJSONReader::PriceHistoryJSONReader  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  PriceHistoryJSONReader::NextRow
+//  Description:  reads one object from the array.
+// =====================================================================================
+
+bool PriceHistoryJSONReader::NextRow(PriceHistoryJSONRow &row)
+{
+    if (finished_)
+    {
+        return false;
+    }
+    row = {};
+
+    SkipWhitespace();
+    Expect('{');
+    SkipWhitespace();
+    if (pos_ < json_text_.size() && json_text_[pos_] == '}')
+    {
+        ++pos_;
+    }
+    else
+    {
+        for (;;)
+        {
+            SkipWhitespace();
+            const auto key = ReadString();
+            SkipWhitespace();
+            Expect(':');
+            SkipWhitespace();
+
+            if (key == "date")
+            {
+                row.date_ = ReadScalar();
+            }
+            else if (key == price_keys_[0])
+            {
+                row.open_ = ReadScalar();
+            }
+            else if (key == price_keys_[1])
+            {
+                row.high_ = ReadScalar();
+            }
+            else if (key == price_keys_[2])
+            {
+                row.low_ = ReadScalar();
+            }
+            else if (key == price_keys_[3])
+            {
+                row.close_ = ReadScalar();
+            }
+            else
+            {
+                SkipValue();
+            }
+
+            SkipWhitespace();
+            if (pos_ == json_text_.size())
+            {
+                ThrowParseError("unexpected end of data in row");
+            }
+            const char next = json_text_[pos_++];
+            if (next == '}')
+            {
+                break;
+            }
+            if (next != ',')
+            {
+                ThrowParseError("expected ',' or '}' in row");
+            }
+        }
+    }
+    ++rows_read_;
+
+    SkipWhitespace();
+    if (pos_ == json_text_.size())
+    {
+        ThrowParseError("unexpected end of data after row");
+    }
+    const char next = json_text_[pos_++];
+    if (next == ']')
+    {
+        finished_ = true;
+    }
+    else if (next != ',')
+    {
+        ThrowParseError("expected ',' or ']' after row");
+    }
+    return true;
+} // -----  end of method PriceHistoryJSONReader::NextRow  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  PriceHistoryJSONReader::FieldToDecimal
+//  Description:  parses straight from the JSON text. No copy needed.
+// =====================================================================================
+
+Decimal PriceHistoryJSONReader::FieldToDecimal(std::string_view field) const
+{
+    Decimal result;
+    if (field.empty() || DecimalFromChars(field, result) != std::errc{})
+    {
+        throw std::runtime_error(
+            std::format("Missing or invalid price: '{}' in price history row: {}", field, rows_read_));
+    }
+    return result;
+} // -----  end of method PriceHistoryJSONReader::FieldToDecimal  -----
+
+void PriceHistoryJSONReader::SkipWhitespace()
+{
+    for (; pos_ < json_text_.size(); ++pos_)
+    {
+        const char c = json_text_[pos_];
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t')
+        {
+            break;
+        }
+    }
+} // -----  end of method PriceHistoryJSONReader::SkipWhitespace  -----
+
+void PriceHistoryJSONReader::Expect(char c)
+{
+    if (pos_ == json_text_.size() || json_text_[pos_] != c)
+    {
+        ThrowParseError(std::format("expected '{}'", c));
+    }
+    ++pos_;
+} // -----  end of method PriceHistoryJSONReader::Expect  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  PriceHistoryJSONReader::ReadString
+//  Description:  returns the raw contents between the quotes. Escapes are skipped
+//                over but not decoded -- none of the fields we want have any.
+// =====================================================================================
+
+std::string_view PriceHistoryJSONReader::ReadString()
+{
+    Expect('"');
+    const auto start = pos_;
+    while (pos_ < json_text_.size())
+    {
+        const char c = json_text_[pos_];
+        if (c == '"')
+        {
+            return json_text_.substr(start, pos_++ - start);
+        }
+        pos_ += c == '\\' ? 2 : 1;
+    }
+    ThrowParseError("unterminated string");
+} // -----  end of method PriceHistoryJSONReader::ReadString  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  PriceHistoryJSONReader::ReadScalar
+//  Description:  prices may be stored as strings or as numbers. Either way we just
+//                want the text.
+// =====================================================================================
+
+std::string_view PriceHistoryJSONReader::ReadScalar()
+{
+    if (pos_ < json_text_.size() && json_text_[pos_] == '"')
+    {
+        return ReadString();
+    }
+    const auto start = pos_;
+    while (pos_ < json_text_.size())
+    {
+        const char c = json_text_[pos_];
+        if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\n' || c == '\r' || c == '\t')
+        {
+            break;
+        }
+        ++pos_;
+    }
+    if (pos_ == start)
+    {
+        ThrowParseError("expected a value");
+    }
+    return json_text_.substr(start, pos_ - start);
+} // -----  end of method PriceHistoryJSONReader::ReadScalar  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  PriceHistoryJSONReader::SkipValue
+//  Description:  skip over any value, including nested objects and arrays.
+// =====================================================================================
+
+void PriceHistoryJSONReader::SkipValue()
+{
+    if (pos_ == json_text_.size())
+    {
+        ThrowParseError("expected a value");
+    }
+    const char c = json_text_[pos_];
+    if (c != '{' && c != '[')
+    {
+        ReadScalar();
+        return;
+    }
+
+    int32_t depth = 0;
+    while (pos_ < json_text_.size())
+    {
+        switch (json_text_[pos_])
+        {
+            case '"':
+                ReadString();
+                continue;
+
+            case '{':
+            case '[':
+                ++depth;
+                break;
+
+            case '}':
+            case ']':
+                if (--depth == 0)
+                {
+                    ++pos_;
+                    return;
+                }
+                break;
+
+            default:
+                break;
+        };
+        ++pos_;
+    }
+    ThrowParseError("unterminated object or array");
+} // -----  end of method PriceHistoryJSONReader::SkipValue  -----
+
+void PriceHistoryJSONReader::ThrowParseError(std::string_view problem) const
+{
+    throw std::runtime_error(
+        std::format("Problem parsing price history JSON at offset: {} row: {}. {}", pos_, rows_read_, problem));
+} // -----  end of method PriceHistoryJSONReader::ThrowParseError  -----
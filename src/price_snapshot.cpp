@@ -0,0 +1,393 @@
+/* =====================================================================================
+ *
+ * Filename:  price_snapshot.cpp
+ *
+ * Description:  Implementation of the binary price history snapshot writer and reader.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 22:58:40
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#include "price_snapshot.h"
+
+namespace
+{
+using UTC_TimePoint = std::chrono::utc_clock::time_point;
+
+// the per row columns each kind of snapshot has.
+
+constexpr std::array StockDataColumns{PriceSnapshotColumn::e_Date, PriceSnapshotColumn::e_Open,
+                                      PriceSnapshotColumn::e_High, PriceSnapshotColumn::e_Low,
+                                      PriceSnapshotColumn::e_Close};
+constexpr std::array DateCloseColumns{PriceSnapshotColumn::e_TimePoint, PriceSnapshotColumn::e_Close};
+constexpr std::array MultiSymbolDateCloseColumns{PriceSnapshotColumn::e_SymbolID, PriceSnapshotColumn::e_TimePoint,
+                                                 PriceSnapshotColumn::e_Close};
+
+struct ColumnToWrite
+{
+    PriceSnapshotColumn column_;
+    uint32_t element_size_;
+    const void *data_;
+    uint64_t element_count_;
+};
+
+template <typename T> ColumnToWrite MakeColumn(PriceSnapshotColumn which, std::span<const T> values)
+{
+    return {which, sizeof(T), values.data(), values.size()};
+}
+
+// offsets_ has one more entry than there are symbols so symbol i is
+// chars_[offsets_[i], offsets_[i + 1]).
+
+struct SymbolTableData
+{
+    std::vector<uint32_t> offsets_;
+    std::string chars_;
+
+    void AddSymbol(std::string_view symbol)
+    {
+        if (offsets_.empty())
+        {
+            offsets_.push_back(0);
+        }
+        chars_ += symbol;
+        offsets_.push_back(static_cast<uint32_t>(chars_.size()));
+    }
+};
+
+constexpr uint64_t AlignColumnOffset(uint64_t offset)
+{
+    return (offset + PriceSnapshotColumnAlignment - 1) & ~(PriceSnapshotColumnAlignment - 1);
+}
+
+void WriteSnapshotFile(const fs::path &file_name, PriceSnapshotKind kind, uint64_t row_count,
+                       const SymbolTableData &symbols, std::vector<ColumnToWrite> columns)
+{
+    columns.insert(columns.begin(),
+                   {MakeColumn(PriceSnapshotColumn::e_SymbolOffsets, std::span<const uint32_t>{symbols.offsets_}),
+                    MakeColumn(PriceSnapshotColumn::e_SymbolChars, std::span<const char>{symbols.chars_})});
+
+    const PriceSnapshotHeader header{.magic_ = PriceSnapshotMagic,
+                                     .version_ = PriceSnapshotVersion,
+                                     .byte_order_mark_ = PriceSnapshotByteOrderMark,
+                                     .kind_ = kind,
+                                     .column_count_ = static_cast<uint32_t>(columns.size()),
+                                     .row_count_ = row_count,
+                                     .symbol_count_ = static_cast<uint32_t>(
+                                         symbols.offsets_.empty() ? 0 : symbols.offsets_.size() - 1),
+                                     .reserved_ = 0};
+
+    std::vector<PriceSnapshotColumnEntry> directory;
+    directory.reserve(columns.size());
+    uint64_t offset = sizeof(PriceSnapshotHeader) + columns.size() * sizeof(PriceSnapshotColumnEntry);
+    for (const auto &column : columns)
+    {
+        offset = AlignColumnOffset(offset);
+        directory.push_back({column.column_, column.element_size_, offset, column.element_count_});
+        offset += column.element_size_ * column.element_count_;
+    }
+
+    std::ofstream output_file{file_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc};
+    BOOST_ASSERT_MSG(output_file.is_open(), std::format("Can't open snapshot file: {}.", file_name).c_str());
+
+    output_file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    output_file.write(reinterpret_cast<const char *>(directory.data()),
+                      static_cast<std::streamsize>(directory.size() * sizeof(PriceSnapshotColumnEntry)));
+
+    const std::array<char, PriceSnapshotColumnAlignment> padding{};
+    uint64_t written = sizeof(PriceSnapshotHeader) + directory.size() * sizeof(PriceSnapshotColumnEntry);
+    for (size_t i = 0; i < columns.size(); ++i)
+    {
+        output_file.write(padding.data(), static_cast<std::streamsize>(directory[i].offset_ - written));
+        const auto how_many_bytes = columns[i].element_size_ * columns[i].element_count_;
+        output_file.write(static_cast<const char *>(columns[i].data_), static_cast<std::streamsize>(how_many_bytes));
+        written = directory[i].offset_ + how_many_bytes;
+    }
+    output_file.close();
+    if (!output_file)
+    {
+        throw std::runtime_error(std::format("Problem writing snapshot file: {}", file_name));
+    }
+}
+} // namespace
+
+// ===  FUNCTION  ======================================================================
+//         Name:  WritePriceSnapshot
+//  Description:
+// =====================================================================================
+
+void WritePriceSnapshot(const fs::path &file_name, const PriceHistoryColumns &history)
+{
+    SymbolTableData symbols;
+    symbols.AddSymbol(history.GetSymbol());
+
+    WriteSnapshotFile(file_name, PriceSnapshotKind::e_StockData, history.size(), symbols,
+                      {MakeColumn(PriceSnapshotColumn::e_Date, history.GetDates()),
+                       MakeColumn(PriceSnapshotColumn::e_Open, history.GetOpens()),
+                       MakeColumn(PriceSnapshotColumn::e_High, history.GetHighs()),
+                       MakeColumn(PriceSnapshotColumn::e_Low, history.GetLows()),
+                       MakeColumn(PriceSnapshotColumn::e_Close, history.GetCloses())});
+} // -----  end of function WritePriceSnapshot  -----
+
+void WritePriceSnapshot(const fs::path &file_name, std::span<const StockDataRecord> history)
+{
+    PriceHistoryColumns columns{history.empty() ? std::string{} : history.front().symbol_};
+    columns.reserve(history.size());
+    for (const auto &record : history)
+    {
+        BOOST_ASSERT_MSG(record.symbol_ == columns.GetSymbol(),
+                         std::format("All records must be for symbol: {} but found: {}.", columns.GetSymbol(),
+                                     record.symbol_)
+                             .c_str());
+        columns.AddRow(std::chrono::sys_days{StringToDateYMD("%Y-%m-%d", std::string_view{record.date_}.substr(0, 10))},
+                       record.open_, record.high_, record.low_, record.close_);
+    }
+    WritePriceSnapshot(file_name, columns);
+} // -----  end of function WritePriceSnapshot  -----
+
+void WritePriceSnapshot(const fs::path &file_name, const std::string &symbol, std::span<const DateCloseRecord> history)
+{
+    SymbolTableData symbols;
+    symbols.AddSymbol(symbol);
+
+    std::vector<UTC_TimePoint> time_points;
+    std::vector<Decimal> closes;
+    time_points.reserve(history.size());
+    closes.reserve(history.size());
+    for (const auto &record : history)
+    {
+        time_points.push_back(record.date_);
+        closes.push_back(record.close_);
+    }
+
+    WriteSnapshotFile(file_name, PriceSnapshotKind::e_DateClose, history.size(), symbols,
+                      {MakeColumn(PriceSnapshotColumn::e_TimePoint, std::span<const UTC_TimePoint>{time_points}),
+                       MakeColumn(PriceSnapshotColumn::e_Close, std::span<const Decimal>{closes})});
+} // -----  end of function WritePriceSnapshot  -----
+
+void WritePriceSnapshot(const fs::path &file_name, std::span<const MultiSymbolDateCloseRecord> history)
+{
+    SymbolRegistry registry;
+    SymbolTableData symbols;
+
+    std::vector<SymbolID> symbol_ids;
+    std::vector<UTC_TimePoint> time_points;
+    std::vector<Decimal> closes;
+    symbol_ids.reserve(history.size());
+    time_points.reserve(history.size());
+    closes.reserve(history.size());
+    for (const auto &record : history)
+    {
+        const auto how_many_symbols = registry.size();
+        const auto id = registry.Intern(record.symbol_);
+        if (registry.size() > how_many_symbols)
+        {
+            symbols.AddSymbol(record.symbol_);
+        }
+        symbol_ids.push_back(id);
+        time_points.push_back(record.date_);
+        closes.push_back(record.close_);
+    }
+
+    WriteSnapshotFile(file_name, PriceSnapshotKind::e_MultiSymbolDateClose, history.size(), symbols,
+                      {MakeColumn(PriceSnapshotColumn::e_SymbolID, std::span<const SymbolID>{symbol_ids}),
+                       MakeColumn(PriceSnapshotColumn::e_TimePoint, std::span<const UTC_TimePoint>{time_points}),
+                       MakeColumn(PriceSnapshotColumn::e_Close, std::span<const Decimal>{closes})});
+} // -----  end of function WritePriceSnapshot  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  PriceSnapshotReader::PriceSnapshotReader
+//  Description:  we check everything we'll later hand out so the accessors don't
+//                have to.
+// =====================================================================================
+
+PriceSnapshotReader::PriceSnapshotReader(const fs::path &file_name) : snapshot_file_{file_name}
+{
+    const auto contents = snapshot_file_.AsBytes();
+    if (contents.size() < sizeof(PriceSnapshotHeader))
+    {
+        throw std::runtime_error(std::format("Snapshot file: {} is too short to be a snapshot.", file_name));
+    }
+    std::memcpy(&header_, contents.data(), sizeof(PriceSnapshotHeader));
+
+    if (header_.magic_ != PriceSnapshotMagic)
+    {
+        throw std::runtime_error(std::format("File: {} is not a price snapshot.", file_name));
+    }
+    if (header_.byte_order_mark_ != PriceSnapshotByteOrderMark)
+    {
+        throw std::runtime_error(std::format("Snapshot file: {} was written with a different byte order.", file_name));
+    }
+    if (header_.version_ != PriceSnapshotVersion)
+    {
+        throw std::runtime_error(std::format("Snapshot file: {} is version: {}. Expected version: {}.", file_name,
+                                             header_.version_, PriceSnapshotVersion));
+    }
+    if (contents.size() < sizeof(PriceSnapshotHeader) + header_.column_count_ * sizeof(PriceSnapshotColumnEntry))
+    {
+        throw std::runtime_error(std::format("Snapshot file: {} is truncated.", file_name));
+    }
+    columns_ = {reinterpret_cast<const PriceSnapshotColumnEntry *>(contents.data() + sizeof(PriceSnapshotHeader)),
+                header_.column_count_};
+
+    symbol_offsets_ = FindColumn<uint32_t>(PriceSnapshotColumn::e_SymbolOffsets);
+    symbol_chars_ = FindColumn<char>(PriceSnapshotColumn::e_SymbolChars);
+    symbol_ids_ = FindColumn<SymbolID>(PriceSnapshotColumn::e_SymbolID);
+    dates_ = FindColumn<std::chrono::sys_days>(PriceSnapshotColumn::e_Date);
+    time_points_ = FindColumn<std::chrono::utc_clock::time_point>(PriceSnapshotColumn::e_TimePoint);
+    opens_ = FindColumn<Decimal>(PriceSnapshotColumn::e_Open);
+    highs_ = FindColumn<Decimal>(PriceSnapshotColumn::e_High);
+    lows_ = FindColumn<Decimal>(PriceSnapshotColumn::e_Low);
+    closes_ = FindColumn<Decimal>(PriceSnapshotColumn::e_Close);
+
+    const bool symbols_ok = header_.symbol_count_ == 0
+                                ? symbol_offsets_.empty()
+                                : symbol_offsets_.size() == header_.symbol_count_ + 1 &&
+                                      std::ranges::is_sorted(symbol_offsets_) &&
+                                      symbol_offsets_.back() <= symbol_chars_.size();
+    if (!symbols_ok)
+    {
+        throw std::runtime_error(std::format("Snapshot file: {} has a damaged symbol table.", file_name));
+    }
+
+    // the columns our kind needs must have a value for every row and the others must
+    // not be there at all. The To... methods rely on this.
+
+    using enum PriceSnapshotColumn;
+    const auto column_sizes = std::to_array<std::pair<PriceSnapshotColumn, size_t>>(
+        {{e_SymbolID, symbol_ids_.size()},
+         {e_Date, dates_.size()},
+         {e_TimePoint, time_points_.size()},
+         {e_Open, opens_.size()},
+         {e_High, highs_.size()},
+         {e_Low, lows_.size()},
+         {e_Close, closes_.size()}});
+
+    std::span<const PriceSnapshotColumn> required;
+    switch (header_.kind_)
+    {
+        using enum PriceSnapshotKind;
+        case e_StockData:
+            required = StockDataColumns;
+            break;
+        case e_DateClose:
+            required = DateCloseColumns;
+            break;
+        case e_MultiSymbolDateClose:
+            required = MultiSymbolDateCloseColumns;
+            break;
+        default:
+            throw std::runtime_error(std::format("Snapshot file: {} has unknown kind: {}.", file_name,
+                                                 std::to_underlying(header_.kind_)));
+    }
+    for (const auto &[column, column_size] : column_sizes)
+    {
+        const bool is_required = std::ranges::find(required, column) != required.end();
+        if (column_size != (is_required ? size() : 0))
+        {
+            throw std::runtime_error(std::format("Snapshot file: {} column: {} has: {} rows. Expected: {}.",
+                                                 file_name, std::to_underlying(column), column_size,
+                                                 is_required ? size() : 0));
+        }
+    }
+} // -----  end of method PriceSnapshotReader::PriceSnapshotReader  -----
+
+template <typename T> std::span<const T> PriceSnapshotReader::FindColumn(PriceSnapshotColumn which) const
+{
+    const auto found = std::ranges::find(columns_, which, &PriceSnapshotColumnEntry::column_);
+    if (found == columns_.end())
+    {
+        return {};
+    }
+    const auto file_size = snapshot_file_.size();
+    if (found->element_size_ != sizeof(T) || found->offset_ % alignof(T) != 0 || found->offset_ > file_size ||
+        found->element_count_ > (file_size - found->offset_) / sizeof(T))
+    {
+        throw std::runtime_error(
+            std::format("Snapshot column: {} is damaged.", std::to_underlying(which)));
+    }
+    return {reinterpret_cast<const T *>(snapshot_file_.data() + found->offset_), found->element_count_};
+} // -----  end of method PriceSnapshotReader::FindColumn  -----
+
+void PriceSnapshotReader::RequireKind(PriceSnapshotKind kind) const
+{
+    // the kind comes from the file so this is a data error, not a programming one.
+
+    if (header_.kind_ != kind)
+    {
+        throw std::runtime_error(std::format("Snapshot holds kind: {} not kind: {}.", std::to_underlying(header_.kind_),
+                                             std::to_underlying(kind)));
+    }
+} // -----  end of method PriceSnapshotReader::RequireKind  -----
+
+PriceHistoryColumns PriceSnapshotReader::ToPriceHistoryColumns() const
+{
+    RequireKind(PriceSnapshotKind::e_StockData);
+
+    PriceHistoryColumns history{std::string{GetSymbolCount() > 0 ? GetSymbol(0) : std::string_view{}}};
+    history.reserve(size());
+    for (size_t i = 0; i < size(); ++i)
+    {
+        history.AddRow(dates_[i], opens_[i], highs_[i], lows_[i], closes_[i]);
+    }
+    return history;
+} // -----  end of method PriceSnapshotReader::ToPriceHistoryColumns  -----
+
+std::vector<StockDataRecord> PriceSnapshotReader::ToStockDataRecords() const
+{
+    RequireKind(PriceSnapshotKind::e_StockData);
+
+    const std::string symbol{GetSymbolCount() > 0 ? GetSymbol(0) : std::string_view{}};
+    std::vector<StockDataRecord> history;
+    history.reserve(size());
+    for (size_t i = 0; i < size(); ++i)
+    {
+        history.push_back({std::format("{:%F}", dates_[i]), symbol, opens_[i], highs_[i], lows_[i], closes_[i]});
+    }
+    return history;
+} // -----  end of method PriceSnapshotReader::ToStockDataRecords  -----
+
+std::vector<DateCloseRecord> PriceSnapshotReader::ToDateCloseRecords() const
+{
+    RequireKind(PriceSnapshotKind::e_DateClose);
+
+    std::vector<DateCloseRecord> history;
+    history.reserve(size());
+    for (size_t i = 0; i < size(); ++i)
+    {
+        history.push_back({time_points_[i], closes_[i]});
+    }
+    return history;
+} // -----  end of method PriceSnapshotReader::ToDateCloseRecords  -----
+
+std::vector<MultiSymbolDateCloseRecord> PriceSnapshotReader::ToMultiSymbolDateCloseRecords() const
+{
+    RequireKind(PriceSnapshotKind::e_MultiSymbolDateClose);
+
+    std::vector<MultiSymbolDateCloseRecord> history;
+    history.reserve(size());
+    for (size_t i = 0; i < size(); ++i)
+    {
+        if (symbol_ids_[i] >= GetSymbolCount())
+        {
+            throw std::runtime_error(std::format("Snapshot row: {} has unknown symbol ID: {}.", i, symbol_ids_[i]));
+        }
+        history.push_back({std::string{GetSymbol(symbol_ids_[i])}, time_points_[i], closes_[i]});
+    }
+    return history;
+} // -----  end of method PriceSnapshotReader::ToMultiSymbolDateCloseRecords  -----
@@ -0,0 +1,413 @@
+/* =====================================================================================
+ *
+ * Filename:  rolling_window.cpp
+ *
+ * Description:  Implementation of the moving window statistics and returns.
+ *
+ * Version:  1.0
+ * Created:  2026-10-17 16:31:27
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <exception>
+#include <format>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ROLLING_WINDOW_HAVE_X86_
+#endif
+
+#include <boost/assert.hpp>
+
+#include "rolling_window.h"
+
+namespace
+{
+void CheckWindow(size_t window)
+{
+    BOOST_ASSERT_MSG(window > 0, "Rolling window must be at least 1.");
+}
+
+// ===  FUNCTION  ======================================================================
+//         Name:  SlidingSum
+//  Description:  add the new value, subtract the one leaving.  For floating point we
+//                start over every 'window' steps which keeps the cost O(1) per step
+//                on average and stops rounding errors accumulating.
+// =====================================================================================
+
+template <typename T> std::vector<T> SlidingSum(std::span<const T> values, size_t window)
+{
+    CheckWindow(window);
+    if (values.size() < window)
+    {
+        return {};
+    }
+    std::vector<T> result(values.size() - window + 1);
+    T sum = std::accumulate(values.begin(), values.begin() + window, T{0});
+    result[0] = sum;
+    for (size_t i = 1; i < result.size(); ++i)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            if (i % window == 0)
+            {
+                sum = std::accumulate(values.begin() + i, values.begin() + i + window, T{0});
+                result[i] = sum;
+                continue;
+            }
+        }
+        sum += values[i + window - 1] - values[i - 1];
+        result[i] = sum;
+    }
+    return result;
+} // -----  end of function SlidingSum  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  SlidingExtreme
+//  Description:  the deque holds indexes of values which could still become the
+//                extreme of some window, with the current extreme at the front.  A
+//                window never holds more than 'window' of them so a fixed ring is
+//                enough.  Its size is a power of 2 so wrapping around is just a mask.
+// =====================================================================================
+
+template <typename T, typename Compare>
+std::vector<T> SlidingExtreme(std::span<const T> values, size_t window, Compare is_better)
+{
+    CheckWindow(window);
+    if (values.size() < window)
+    {
+        return {};
+    }
+    std::vector<T> result(values.size() - window + 1);
+
+    std::vector<size_t> ring(std::bit_ceil(window));
+    const size_t mask = ring.size() - 1;
+    size_t head = 0;
+    size_t count = 0;
+    auto at = [&](size_t k) -> size_t & { return ring[(head + k) & mask]; };
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        if (count > 0 && at(0) + window <= i)
+        {
+            head = (head + 1) & mask;
+            --count;
+        }
+        while (count > 0 && !is_better(values[at(count - 1)], values[i]))
+        {
+            --count;
+        }
+        at(count) = i;
+        ++count;
+        if (i + 1 >= window)
+        {
+            result[i + 1 - window] = values[at(0)];
+        }
+    }
+    return result;
+} // -----  end of function SlidingExtreme  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  SlidingVariance
+//  Description:  Welford's running mean and sum of squared differences, updated
+//                for a value entering and one leaving.  Like the sums, we start over
+//                every 'window' steps.
+// =====================================================================================
+
+std::vector<double> SlidingVariance(std::span<const double> values, size_t window)
+{
+    CheckWindow(window);
+    if (values.size() < window)
+    {
+        return {};
+    }
+    std::vector<double> result(values.size() - window + 1);
+    if (window == 1)
+    {
+        return result;
+    }
+
+    double mean = 0.0;
+    double m2 = 0.0;
+    auto start_over = [&](size_t first) {
+        mean = 0.0;
+        m2 = 0.0;
+        for (size_t k = 0; k < window; ++k)
+        {
+            const double delta = values[first + k] - mean;
+            mean += delta / static_cast<double>(k + 1);
+            m2 += delta * (values[first + k] - mean);
+        }
+    };
+
+    const auto n = static_cast<double>(window);
+    start_over(0);
+    result[0] = m2 / (n - 1);
+    for (size_t i = 1; i < result.size(); ++i)
+    {
+        if (i % window == 0)
+        {
+            start_over(i);
+        }
+        else
+        {
+            const double leaving = values[i - 1];
+            const double entering = values[i + window - 1];
+            const double delta = entering - leaving;
+            const double old_mean = mean;
+            mean += delta / n;
+            m2 = std::max(0.0, m2 + delta * (entering - mean + leaving - old_mean));
+        }
+        result[i] = m2 / (n - 1);
+    }
+    return result;
+} // -----  end of function SlidingVariance  -----
+
+using SimpleReturnsFn = void (*)(const double *, double *, size_t);
+
+void SimpleReturnsScalar(const double *values, double *returns, size_t how_many)
+{
+    for (size_t i = 0; i < how_many; ++i)
+    {
+        returns[i] = values[i + 1] / values[i] - 1.0;
+    }
+}
+
+#ifdef ROLLING_WINDOW_HAVE_X86_
+
+__attribute__((target("avx2"))) void SimpleReturnsAVX2(const double *values, double *returns, size_t how_many)
+{
+    const __m256d one = _mm256_set1_pd(1.0);
+    size_t i = 0;
+    for (; i + 4 <= how_many; i += 4)
+    {
+        const __m256d previous = _mm256_loadu_pd(values + i);
+        const __m256d current = _mm256_loadu_pd(values + i + 1);
+        _mm256_storeu_pd(returns + i, _mm256_sub_pd(_mm256_div_pd(current, previous), one));
+    }
+    SimpleReturnsScalar(values + i, returns + i, how_many - i);
+}
+
+#endif
+
+SimpleReturnsFn SelectSimpleReturns()
+{
+#ifdef ROLLING_WINDOW_HAVE_X86_
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return SimpleReturnsAVX2;
+    }
+#endif
+    return SimpleReturnsScalar;
+}
+
+template <typename Records> std::vector<double> ExtractCloseValues(const Records &records)
+{
+    std::vector<double> result;
+    result.reserve(records.size());
+    for (const auto &record : records)
+    {
+        result.push_back(static_cast<double>(record.close_));
+    }
+    return result;
+}
+} // namespace
+
+std::vector<double> ExtractCloses(std::span<const DateCloseRecord> records)
+{
+    return ExtractCloseValues(records);
+} // -----  end of function ExtractCloses  -----
+
+std::vector<double> ExtractCloses(std::span<const StockDataRecord> records)
+{
+    return ExtractCloseValues(records);
+} // -----  end of function ExtractCloses  -----
+
+std::vector<double> ExtractCloses(const PriceHistoryColumns &prices)
+{
+    std::vector<double> result;
+    result.reserve(prices.size());
+    for (const auto &close : prices.GetCloses())
+    {
+        result.push_back(static_cast<double>(close));
+    }
+    return result;
+} // -----  end of function ExtractCloses  -----
+
+std::vector<double> RollingSum(std::span<const double> values, size_t window)
+{
+    return SlidingSum(values, window);
+} // -----  end of function RollingSum  -----
+
+std::vector<int64_t> RollingSum(std::span<const int64_t> values, size_t window)
+{
+    return SlidingSum(values, window);
+} // -----  end of function RollingSum  -----
+
+std::vector<double> RollingMean(std::span<const double> values, size_t window)
+{
+    auto result = SlidingSum(values, window);
+    const auto n = static_cast<double>(window);
+    std::ranges::for_each(result, [n](double &sum) { sum /= n; });
+    return result;
+} // -----  end of function RollingMean  -----
+
+std::vector<double> RollingMin(std::span<const double> values, size_t window)
+{
+    return SlidingExtreme(values, window, std::less<>{});
+} // -----  end of function RollingMin  -----
+
+std::vector<double> RollingMax(std::span<const double> values, size_t window)
+{
+    return SlidingExtreme(values, window, std::greater<>{});
+} // -----  end of function RollingMax  -----
+
+std::vector<int64_t> RollingMin(std::span<const int64_t> values, size_t window)
+{
+    return SlidingExtreme(values, window, std::less<>{});
+} // -----  end of function RollingMin  -----
+
+std::vector<int64_t> RollingMax(std::span<const int64_t> values, size_t window)
+{
+    return SlidingExtreme(values, window, std::greater<>{});
+} // -----  end of function RollingMax  -----
+
+std::vector<double> RollingVariance(std::span<const double> values, size_t window)
+{
+    return SlidingVariance(values, window);
+} // -----  end of function RollingVariance  -----
+
+std::vector<double> RollingStdDev(std::span<const double> values, size_t window)
+{
+    auto result = SlidingVariance(values, window);
+    std::ranges::for_each(result, [](double &variance) { variance = std::sqrt(variance); });
+    return result;
+} // -----  end of function RollingStdDev  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  SimpleReturns
+//  Description:  the implementation is chosen on first use.
+// =====================================================================================
+
+std::vector<double> SimpleReturns(std::span<const double> values)
+{
+    static const SimpleReturnsFn simple_returns = SelectSimpleReturns();
+    if (values.size() < 2)
+    {
+        return {};
+    }
+    std::vector<double> result(values.size() - 1);
+    simple_returns(values.data(), result.data(), result.size());
+    return result;
+} // -----  end of function SimpleReturns  -----
+
+std::vector<double> LogReturns(std::span<const double> values)
+{
+    if (values.size() < 2)
+    {
+        return {};
+    }
+    std::vector<double> result(values.size() - 1);
+    for (size_t i = 0; i < result.size(); ++i)
+    {
+        result[i] = std::log(values[i + 1] / values[i]);
+    }
+    return result;
+} // -----  end of function LogReturns  -----
+
+std::vector<double> ComputeRolling(RollingStatistic statistic, std::span<const double> values, size_t window)
+{
+    switch (statistic)
+    {
+        using enum RollingStatistic;
+        case e_Sum:
+            return RollingSum(values, window);
+        case e_Mean:
+            return RollingMean(values, window);
+        case e_Min:
+            return RollingMin(values, window);
+        case e_Max:
+            return RollingMax(values, window);
+        case e_Variance:
+            return RollingVariance(values, window);
+        case e_StdDev:
+            return RollingStdDev(values, window);
+    }
+    throw std::invalid_argument(std::format("Unknown rolling statistic: {}", static_cast<int32_t>(statistic)));
+} // -----  end of function ComputeRolling  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  ComputeRollingBatch
+//  Description:  series can be very different lengths so threads take the next
+//                unclaimed series rather than a fixed share.  Exceptions are carried
+//                back and the first one is rethrown.
+// =====================================================================================
+
+std::vector<std::vector<double>> ComputeRollingBatch(RollingStatistic statistic,
+                                                     std::span<const std::vector<double>> series, size_t window,
+                                                     uint32_t thread_count)
+{
+    std::vector<std::vector<double>> results(series.size());
+
+    if (thread_count == 0)
+    {
+        thread_count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    thread_count = static_cast<uint32_t>(std::clamp<size_t>(series.size(), 1, thread_count));
+
+    if (thread_count == 1)
+    {
+        for (size_t i = 0; i < series.size(); ++i)
+        {
+            results[i] = ComputeRolling(statistic, series[i], window);
+        }
+        return results;
+    }
+
+    std::atomic<size_t> next_series{0};
+    std::vector<std::exception_ptr> problems(thread_count);
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(thread_count);
+        for (uint32_t t = 0; t < thread_count; ++t)
+        {
+            workers.emplace_back([&, &problem = problems[t]] {
+                try
+                {
+                    for (size_t i = next_series++; i < series.size(); i = next_series++)
+                    {
+                        results[i] = ComputeRolling(statistic, series[i], window);
+                    }
+                }
+                catch (...)
+                {
+                    problem = std::current_exception();
+                }
+            });
+        }
+    }
+    for (const auto &problem : problems)
+    {
+        if (problem)
+        {
+            std::rethrow_exception(problem);
+        }
+    }
+    return results;
+} // -----  end of function ComputeRollingBatch  -----
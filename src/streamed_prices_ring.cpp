@@ -0,0 +1,77 @@
+/* =====================================================================================
+ *
+ * Filename:  streamed_prices_ring.cpp
+ *
+ * Description:  Implementation of fixed capacity streamed price storage.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 18:24:40
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <format>
+
+#include <boost/assert.hpp>
+
+#include "streamed_prices_ring.h"
+
+StreamedPricesRing::StreamedPricesRing(size_t capacity, std::chrono::seconds time_window)
+    : timestamp_seconds_(2 * capacity),
+      price_(2 * capacity),
+      signal_type_(2 * capacity),
+      capacity_{capacity},
+      time_window_seconds_{time_window.count()}
+{
+    BOOST_ASSERT_MSG(capacity > 0, "StreamedPricesRing capacity must be positive.");
+    BOOST_ASSERT_MSG(time_window_seconds_ >= 0,
+                     std::format("Invalid retention time window: {}", time_window_seconds_).c_str());
+} // -----  end of method StreamedPricesRing::StreamedPricesRing  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  StreamedPricesRing::Append
+//  Description:  drop the oldest entry if we are full, write the new entry to both
+//                halves, then apply the time window (if any).
+// =====================================================================================
+
+void StreamedPricesRing::Append(int64_t timestamp_seconds, double price, int32_t signal_type)
+{
+    if (size_ == capacity_)
+    {
+        head_ = head_ + 1 == capacity_ ? 0 : head_ + 1;
+        --size_;
+    }
+
+    auto slot = head_ + size_;
+    if (slot >= capacity_)
+    {
+        slot -= capacity_;
+    }
+    timestamp_seconds_[slot] = timestamp_seconds_[slot + capacity_] = timestamp_seconds;
+    price_[slot] = price_[slot + capacity_] = price;
+    signal_type_[slot] = signal_type_[slot + capacity_] = signal_type;
+    ++size_;
+
+    if (time_window_seconds_ > 0)
+    {
+        const auto oldest_to_keep = timestamp_seconds - time_window_seconds_;
+        while (size_ > 1 && timestamp_seconds_[head_] < oldest_to_keep)
+        {
+            head_ = head_ + 1 == capacity_ ? 0 : head_ + 1;
+            --size_;
+        }
+    }
+} // -----  end of method StreamedPricesRing::Append  -----
+
+StreamedPrices StreamedPricesRing::ToStreamedPrices() const
+{
+    const auto view = GetView();
+    return {{view.timestamp_seconds_.begin(), view.timestamp_seconds_.end()},
+            {view.price_.begin(), view.price_.end()},
+            {view.signal_type_.begin(), view.signal_type_.end()}};
+} // -----  end of method StreamedPricesRing::ToStreamedPrices  -----
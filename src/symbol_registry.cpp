@@ -0,0 +1,35 @@
+/* =====================================================================================
+ *
+ * Filename:  symbol_registry.cpp
+ *
+ * Description:  Implementation of symbol to ID registry.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 19:15:27
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include "symbol_registry.h"
+
+// ===  FUNCTION  ======================================================================
+//         Name:  SymbolRegistry::Intern
+//  Description:  only builds a std::string the first time we see a symbol.
+// =====================================================================================
+
+SymbolID SymbolRegistry::Intern(std::string_view symbol)
+{
+    if (auto found = ids_.find(symbol); found != ids_.end())
+    {
+        return found->second;
+    }
+    const auto id = static_cast<SymbolID>(symbols_.size());
+    const auto where = ids_.emplace(std::string{symbol}, id).first;
+    symbols_.push_back(where->first);
+    return id;
+} // -----  end of method SymbolRegistry::Intern  -----
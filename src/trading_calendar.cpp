@@ -0,0 +1,222 @@
+/* =====================================================================================
+ *
+ * Filename:  trading_calendar.cpp
+ *
+ * Description:  Implementation of precomputed US market trading calendar.
+ *
+ * Version:  1.0
+ * Created:  2026-10-16 09:14:02
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+
+#include <boost/assert.hpp>
+
+using namespace std::chrono_literals;
+
+namespace rng = std::ranges;
+
+#include "trading_calendar.h"
+#include "us_holidays.h"
+
+// ===  FUNCTION  ======================================================================
+//         Name:  TradingCalendar::TradingCalendar
+//  Description:  start with all weekdays marked as trading days then clear the bits
+//                for each year's holidays.
+// =====================================================================================
+
+TradingCalendar::TradingCalendar(std::chrono::year first_year, std::chrono::year last_year)
+    : first_year_{first_year},
+      last_year_{last_year},
+      first_day_{first_year / std::chrono::January / 1d},
+      last_day_{last_year / std::chrono::December / 31d}
+{
+    BOOST_ASSERT_MSG(first_year <= last_year, std::format("Invalid calendar range: {} - {}.",
+                                                          static_cast<int>(first_year), static_cast<int>(last_year))
+                                                  .c_str());
+
+    const auto how_many_days = static_cast<uint32_t>((last_day_ - first_day_).count()) + 1;
+    trading_days_.resize((how_many_days + 63) / 64, 0);
+
+    std::chrono::weekday which_day{first_day_};
+    for (uint32_t offset = 0; offset < how_many_days; ++offset, ++which_day)
+    {
+        if (which_day != std::chrono::Saturday && which_day != std::chrono::Sunday)
+        {
+            trading_days_[offset / 64] |= uint64_t{1} << (offset % 64);
+        }
+    }
+
+    for (auto which_year = first_year; which_year <= last_year; ++which_year)
+    {
+        for (const auto &[name, a_day] : MakeHolidayList(which_year))
+        {
+            const std::chrono::sys_days holiday{a_day};
+            if (IsInRange(holiday))
+            {
+                const auto offset = static_cast<uint32_t>((holiday - first_day_).count());
+                trading_days_[offset / 64] &= ~(uint64_t{1} << (offset % 64));
+            }
+        }
+    }
+
+    // now we can build our rank and select indexes.
+
+    trading_days_before_block_.reserve(trading_days_.size());
+    uint32_t running_count = 0;
+    for (const auto block : trading_days_)
+    {
+        trading_days_before_block_.push_back(running_count);
+        running_count += std::popcount(block);
+    }
+
+    trading_day_list_.reserve(running_count);
+    for (uint32_t offset = 0; offset < how_many_days; ++offset)
+    {
+        if (((trading_days_[offset / 64] >> (offset % 64)) & 1U) != 0)
+        {
+            trading_day_list_.push_back(first_day_ + std::chrono::days{offset});
+        }
+    }
+} // -----  end of method TradingCalendar::TradingCalendar  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  TradingCalendar::AddBusinessDays
+//  Description:  uses rank/select when the answer is within our span, otherwise
+//                walks a day at a time.
+// =====================================================================================
+
+std::chrono::sys_days TradingCalendar::AddBusinessDays(std::chrono::sys_days a_day, int32_t n) const
+{
+    if (n == 0)
+    {
+        return a_day;
+    }
+    if (IsInRange(a_day))
+    {
+        if (n > 0)
+        {
+            const auto which = CountTradingDaysBefore(a_day + std::chrono::days{1}) + n - 1;
+            if (which < static_cast<int32_t>(trading_day_list_.size()))
+            {
+                return trading_day_list_[which];
+            }
+        }
+        else
+        {
+            const auto which = CountTradingDaysBefore(a_day) + n;
+            if (which >= 0)
+            {
+                return trading_day_list_[which];
+            }
+        }
+    }
+
+    const std::chrono::days day_increment{n > 0 ? 1 : -1};
+    for (auto remaining = std::abs(n); remaining > 0;)
+    {
+        a_day += day_increment;
+        if (IsTradingDay(a_day))
+        {
+            --remaining;
+        }
+    }
+    return a_day;
+} // -----  end of method TradingCalendar::AddBusinessDays  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  TradingCalendar::BusinessDaysBetween
+//  Description:
+// =====================================================================================
+
+int32_t TradingCalendar::BusinessDaysBetween(std::chrono::sys_days from, std::chrono::sys_days to) const
+{
+    if (to < from)
+    {
+        return -BusinessDaysBetween(to, from);
+    }
+    if (IsInRange(from) && to <= last_day_ + std::chrono::days{1})
+    {
+        return CountTradingDaysBefore(to) - CountTradingDaysBefore(from);
+    }
+
+    int32_t how_many = 0;
+    for (; from < to; from += std::chrono::days{1})
+    {
+        how_many += IsTradingDay(from) ? 1 : 0;
+    }
+    return how_many;
+} // -----  end of method TradingCalendar::BusinessDaysBetween  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  TradingCalendar::NthTradingDayOfMonth
+//  Description:
+// =====================================================================================
+
+std::optional<std::chrono::year_month_day> TradingCalendar::NthTradingDayOfMonth(std::chrono::year_month which_month,
+                                                                                 int32_t n) const
+{
+    if (n < 1)
+    {
+        return std::nullopt;
+    }
+    const std::chrono::sys_days first_of_month{which_month / 1d};
+    const std::chrono::sys_days end_of_month{which_month / std::chrono::last};
+
+    if (IsInRange(first_of_month) && IsInRange(end_of_month))
+    {
+        const auto which = CountTradingDaysBefore(first_of_month) + n - 1;
+        if (which < CountTradingDaysBefore(end_of_month + std::chrono::days{1}))
+        {
+            return std::chrono::year_month_day{trading_day_list_[which]};
+        }
+        return std::nullopt;
+    }
+
+    auto nth_day = AddBusinessDays(first_of_month - std::chrono::days{1}, n);
+    if (nth_day > end_of_month)
+    {
+        return std::nullopt;
+    }
+    return std::chrono::year_month_day{nth_day};
+} // -----  end of method TradingCalendar::NthTradingDayOfMonth  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  TradingCalendar::IsTradingDayByRule
+//  Description:  slow path for days outside the precomputed span.
+// =====================================================================================
+
+bool TradingCalendar::IsTradingDayByRule(std::chrono::sys_days a_day)
+{
+    std::chrono::weekday d1{a_day};
+    if (d1 == std::chrono::Saturday || d1 == std::chrono::Sunday)
+    {
+        return false;
+    }
+
+    const std::chrono::year_month_day ymd{a_day};
+    auto holidays = MakeHolidayList(ymd.year());
+    return rng::find(holidays, ymd, [](const auto &e) { return e.second; }) == holidays.end();
+} // -----  end of method TradingCalendar::IsTradingDayByRule  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  GetUS_TradingCalendar
+//  Description:
+// =====================================================================================
+
+const TradingCalendar &GetUS_TradingCalendar()
+{
+    static const TradingCalendar us_calendar{1900y, 2100y};
+    return us_calendar;
+} // -----  end of function GetUS_TradingCalendar  -----
@@ -15,157 +15,60 @@
  * =====================================================================================
  */
 
-extern "C"
-{
-#include "calfaq.h"
-}
-
+#include "instrumentation.h"
 #include "us_holidays.h"
 
-// Static list of holiday rule instances
-static const std::vector<HolidayRuleVariant> HolidayRules = {
-    NewYearsHoliday{},     MLKDayHoliday{},     WashingtonBdayHoliday{},  GoodFridayHoliday{},
-    MemorialDayHoliday{},  JuneteenthHoliday{}, IndependenceDayHoliday{}, LaborDayHoliday{},
-    ThanksgivingHoliday{}, ChristmasHoliday{},  CartersDayHoliday{}};
+// --- Compile time checks of our holiday rules ---
 
-// --- Individual Holiday Rule Structs Implementations ---
+static_assert(EasterSunday(2000y) == 2000y / std::chrono::April / 23d);
+static_assert(EasterSunday(2024y) == 2024y / std::chrono::March / 31d);
+static_assert(EasterSunday(2025y) == 2025y / std::chrono::April / 20d);
+static_assert(EasterSunday(2038y) == 2038y / std::chrono::April / 25d);
 
-std::optional<US_MarketHoliday> NewYearsHoliday::operator()(std::chrono::year which_year) const
-{
-    std::chrono::sys_days newyears = which_year / holiday_rule_.month() / holiday_rule_.day();
-    std::chrono::year_month_weekday newyearsday{newyears};
-    const std::chrono::weekday which_day = newyearsday.weekday();
-    if (which_day == std::chrono::Sunday)
-    {
-        newyears += std::chrono::days{1};
-    }
-    if (which_day != std::chrono::Saturday)
-    { // If Saturday, no observed holiday.
-        return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{newyears}};
-    }
-    return std::nullopt;
-}
+static_assert(GoodFridayHoliday{}(2025y)->second == 2025y / std::chrono::April / 18d);
+static_assert(!NewYearsHoliday{}(2022y)); // New Years on Saturday is not observed.
+static_assert(NewYearsHoliday{}(2023y)->second == 2023y / std::chrono::January / 2d);
+static_assert(!JuneteenthHoliday{}(2021y));
+static_assert(IndependenceDayHoliday{}(2026y)->second == 2026y / std::chrono::July / 3d);
+static_assert(ChristmasHoliday{}(2022y)->second == 2022y / std::chrono::December / 26d);
 
-std::optional<US_MarketHoliday> MLKDayHoliday::operator()(std::chrono::year which_year) const
-{
-    std::chrono::year_month_weekday mlk = {which_year, holiday_rule_.month(), holiday_rule_.weekday_indexed()};
-    return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{mlk}};
-}
+static_assert(CountUS_MarketHolidays(2024y, 2024y) == 10);
+static_assert(CountUS_MarketHolidays(2025y, 2025y) == 11);
 
-std::optional<US_MarketHoliday> WashingtonBdayHoliday::operator()(std::chrono::year which_year) const
+namespace
 {
-    std::chrono::year_month_weekday wbd = {which_year, holiday_rule_.month(), holiday_rule_.weekday_indexed()};
-    return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{wbd}};
-}
+constexpr auto holidays_2022_2026 = MakeUS_MarketHolidayTable<2022, 2026>();
+static_assert(std::ranges::is_sorted(holidays_2022_2026));
+static_assert(IsUS_MarketHoliday(holidays_2022_2026, 2025y / std::chrono::January / 9d));
+static_assert(IsUS_MarketHoliday(holidays_2022_2026, 2024y / std::chrono::November / 28d));
+static_assert(!IsUS_MarketHoliday(holidays_2022_2026, 2021y / std::chrono::December / 31d));
+static_assert(!IsUS_MarketHoliday(holidays_2022_2026, 2024y / std::chrono::November / 29d));
+} // namespace
 
-std::optional<US_MarketHoliday> GoodFridayHoliday::operator()(std::chrono::year which_year) const
-{
-    int month = 0;
-    int day = 0;
-    easter(GREGORIAN, which_year.operator int(), &month, &day);
-    std::chrono::year_month_day easter_sunday{which_year, std::chrono::month(month), std::chrono::day(day)};
-    std::chrono::sys_days good_friday_sys_days = std::chrono::sys_days{easter_sunday} - std::chrono::days{2};
-    return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{good_friday_sys_days}};
-}
-
-std::optional<US_MarketHoliday> MemorialDayHoliday::operator()(std::chrono::year which_year) const
-{
-    std::chrono::year_month_weekday_last md = {which_year, holiday_rule_.month(), holiday_rule_.weekday_last()};
-    return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{md}};
-}
-
-std::optional<US_MarketHoliday> JuneteenthHoliday::operator()(std::chrono::year which_year) const
-{
-    if (which_year >= 2022y)
-    { // first use of this holiday is 2022
-        std::chrono::sys_days hday = which_year / holiday_rule_.month() / holiday_rule_.day();
-        std::chrono::year_month_weekday hwday{hday};
-        const std::chrono::weekday which_day = hwday.weekday();
-        if (which_day == std::chrono::Sunday)
-        {
-            hday += std::chrono::days{1};
-        }
-        else if (which_day == std::chrono::Saturday)
-        {
-            hday -= std::chrono::days{1};
-        }
-        return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{hday}};
-    }
-    return std::nullopt;
-}
-
-std::optional<US_MarketHoliday> IndependenceDayHoliday::operator()(std::chrono::year which_year) const
+// ===  FUNCTION  ======================================================================
+//         Name:  MakeHolidayList
+//  Description:
+// =====================================================================================
+US_MarketHolidays MakeHolidayList(std::chrono::year which_year)
 {
-    std::chrono::sys_days hday = which_year / holiday_rule_.month() / holiday_rule_.day();
-    std::chrono::year_month_weekday hwday{hday};
-    const std::chrono::weekday which_day = hwday.weekday();
-    if (which_day == std::chrono::Sunday)
-    {
-        hday += std::chrono::days{1};
-    }
-    else if (which_day == std::chrono::Saturday)
-    {
-        hday -= std::chrono::days{1};
-    }
-    return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{hday}};
-}
+    INSTRUMENT_TIMER(timer, "make_holiday_list", "");
 
-std::optional<US_MarketHoliday> LaborDayHoliday::operator()(std::chrono::year which_year) const
-{
-    std::chrono::year_month_weekday ld = {which_year, holiday_rule_.month(), holiday_rule_.weekday_indexed()};
-    return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{ld}};
-}
+    US_MarketHolidays h_days;
+    h_days.reserve(US_MarketHolidayRules.size());
 
-std::optional<US_MarketHoliday> ThanksgivingHoliday::operator()(std::chrono::year which_year) const
-{
-    std::chrono::year_month_weekday tg = {which_year, holiday_rule_.month(), holiday_rule_.weekday_indexed()};
-    return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{tg}};
-}
+    ForEachUS_MarketHoliday(which_year, [&h_days](const US_MarketHoliday &holiday) { h_days.emplace_back(holiday); });
 
-std::optional<US_MarketHoliday> ChristmasHoliday::operator()(std::chrono::year which_year) const
-{
-    std::chrono::sys_days hday = which_year / holiday_rule_.month() / holiday_rule_.day();
-    std::chrono::year_month_weekday hwday{hday};
-    const std::chrono::weekday which_day = hwday.weekday();
-    if (which_day == std::chrono::Sunday)
-    {
-        hday += std::chrono::days{1};
-    }
-    else if (which_day == std::chrono::Saturday)
-    {
-        hday -= std::chrono::days{1};
-    }
-    return US_MarketHoliday{holiday_name_, std::chrono::year_month_day{hday}};
+    return h_days;
 }
 
-std::optional<US_MarketHoliday> CartersDayHoliday::operator()(std::chrono::year which_year) const
+PMR_US_MarketHolidays MakeHolidayList(std::chrono::year which_year, std::pmr::memory_resource *resource)
 {
-    if (which_year == holiday_rule_.year())
-    {
-        return US_MarketHoliday{holiday_name_, holiday_rule_};
-    }
-    return std::nullopt;
-}
+    INSTRUMENT_TIMER(timer, "make_holiday_list", "");
 
-// ===  FUNCTION  ======================================================================
-//         Name:  MakeHolidayList
-//  Description:
-// =====================================================================================
-US_MarketHolidays MakeHolidayList(std::chrono::year which_year)
-{
-    US_MarketHolidays h_days;
+    PMR_US_MarketHolidays h_days{resource};
+    h_days.reserve(US_MarketHolidayRules.size());
 
-    for (const auto &h_rule : HolidayRules)
-    {
-        std::visit(
-            [&](const auto &rule_struct) {
-                if (auto holiday = rule_struct(which_year); holiday)
-                {
-                    h_days.emplace_back(*holiday);
-                }
-            },
-            h_rule);
-    }
+    ForEachUS_MarketHoliday(which_year, [&h_days](const US_MarketHoliday &holiday) { h_days.emplace_back(holiday); });
 
     return h_days;
 }
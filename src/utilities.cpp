@@ -17,15 +17,19 @@
  */
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdint>
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <memory_resource>
 #include <optional> // Added for std::optional
 #include <print>
 #include <stacktrace>
 #include <stdexcept>
 #include <string_view>
+#include <thread>
 #include <variant>
 #include <vector>
 
@@ -34,11 +38,22 @@ using namespace std::chrono_literals;
 namespace rng = std::ranges;
 namespace vws = std::ranges::views;
 
+#include "decimal_from_chars.h"
+#include "instrumentation.h"
+#include "mapped_file.h"
+#include "price_history_reader.h"
+#include "trading_calendar.h"
 #include "utilities.h"
-extern "C"
+
+// ===  FUNCTION  ======================================================================
+//         Name:  GetUS_MarketTimeZone
+//  Description:  look this up just once instead of by name on every call.
+// =====================================================================================
+const std::chrono::time_zone *GetUS_MarketTimeZone()
 {
-#include "calfaq.h"
-}
+    static const std::chrono::time_zone *us_market_zone = std::chrono::locate_zone("America/New_York");
+    return us_market_zone;
+} // -----  end of function GetUS_MarketTimeZone  -----
 
 // ===  FUNCTION  ======================================================================
 //         Name:  GetUS_MarketOpen
@@ -46,7 +61,7 @@ extern "C"
 // =====================================================================================
 US_MarketTime GetUS_MarketOpenTime(const std::chrono::year_month_day &a_day)
 {
-    return std::chrono::zoned_seconds("America/New_York", std::chrono::local_days{a_day} + 9h + 30min + 0s);
+    return std::chrono::zoned_seconds(GetUS_MarketTimeZone(), std::chrono::local_days{a_day} + 9h + 30min + 0s);
 } // -----  end of function GetUS_MarketOpen  -----
 
 // ===  FUNCTION  ======================================================================
@@ -55,7 +70,7 @@ US_MarketTime GetUS_MarketOpenTime(const std::chrono::year_month_day &a_day)
 // =====================================================================================
 US_MarketTime GetUS_MarketCloseTime(const std::chrono::year_month_day &a_day)
 {
-    return std::chrono::zoned_seconds{"America/New_York", std::chrono::local_days{a_day} + 16h + 0min + 0s};
+    return std::chrono::zoned_seconds{GetUS_MarketTimeZone(), std::chrono::local_days{a_day} + 16h + 0min + 0s};
 } // -----  end of function GetUS_MarketClose  -----
 
 // ===  FUNCTION  ======================================================================
@@ -69,7 +84,7 @@ US_MarketStatus GetUS_MarketStatus(std::string_view local_time_zone_name, std::c
     // If not, then we check to see if we are within trading hours.
 
     const auto users_local_time = std::chrono::zoned_seconds(local_time_zone_name, a_time);
-    const auto time_in_US = std::chrono::zoned_seconds("America/New_York", users_local_time);
+    const auto time_in_US = std::chrono::zoned_seconds(GetUS_MarketTimeZone(), users_local_time);
 
     //    std::cout << "current user's local time: " <<  users_local_time  << '\n';
     //    std::cout << "current user's time in US: " <<  time_in_US  << '\n';
@@ -81,8 +96,10 @@ US_MarketStatus GetUS_MarketStatus(std::string_view local_time_zone_name, std::c
     {
         return US_MarketStatus::e_NonTradingDay;
     }
-    auto local_market_open = std::chrono::zoned_seconds(local_time_zone_name, GetUS_MarketOpenTime(today_in_US));
-    auto local_market_close = std::chrono::zoned_seconds(local_time_zone_name, GetUS_MarketCloseTime(today_in_US));
+    // we only compare instants so there's no need to convert these to the user's time zone.
+
+    auto local_market_open = GetUS_MarketOpenTime(today_in_US);
+    auto local_market_close = GetUS_MarketCloseTime(today_in_US);
 
     //    std::cout << "Local Market Open: " <<  local_market_open << " Local Market Close: " << local_market_close <<
     //    '\n';
@@ -107,6 +124,209 @@ std::string UTCTimePointToLocalTZHMSString(std::chrono::utc_clock::time_point a_
     return result;
 } // -----  end of function UTCTimePointToLocalTZHMSString  -----
 
+// hand written parsers for the fixed ISO-8601 style formats we see most often.
+// These do no allocation. Anything they don't recognize or can't parse is left
+// to the stream based code so error handling and odd inputs are unchanged.
+
+namespace
+{
+enum class ISOZoneSuffix : int32_t
+{
+    e_None,
+    e_Z,
+    e_Offset,
+    e_OffsetWithColon
+};
+
+struct ISOTimeFormat
+{
+    bool has_time_ = false;
+    char separator_ = 'T';
+    ISOZoneSuffix zone_suffix_ = ISOZoneSuffix::e_None;
+};
+
+// recognize: %Y-%m-%d[(T| )%H:%M:%S[Z|%z|%Ez|%Oz]]
+
+std::optional<ISOTimeFormat> MatchISOTimeFormat(std::string_view input_format)
+{
+    if (!input_format.starts_with("%Y-%m-%d"))
+    {
+        return std::nullopt;
+    }
+    input_format.remove_prefix(8);
+    if (input_format.empty())
+    {
+        return ISOTimeFormat{};
+    }
+
+    ISOTimeFormat result{.has_time_ = true, .separator_ = input_format[0]};
+    if (result.separator_ != 'T' && result.separator_ != ' ')
+    {
+        return std::nullopt;
+    }
+    input_format.remove_prefix(1);
+    if (!input_format.starts_with("%H:%M:%S"))
+    {
+        return std::nullopt;
+    }
+    input_format.remove_prefix(8);
+
+    if (input_format.empty())
+    {
+        result.zone_suffix_ = ISOZoneSuffix::e_None;
+    }
+    else if (input_format == "Z")
+    {
+        result.zone_suffix_ = ISOZoneSuffix::e_Z;
+    }
+    else if (input_format == "%z")
+    {
+        result.zone_suffix_ = ISOZoneSuffix::e_Offset;
+    }
+    else if (input_format == "%Ez" || input_format == "%Oz")
+    {
+        result.zone_suffix_ = ISOZoneSuffix::e_OffsetWithColon;
+    }
+    else
+    {
+        return std::nullopt;
+    }
+    return result;
+}
+
+// read exactly 'how_many' digits starting at 'pos'.
+
+bool ReadDigits(std::string_view text, size_t pos, size_t how_many, int32_t &value)
+{
+    if (pos + how_many > text.size())
+    {
+        return false;
+    }
+    value = 0;
+    for (size_t i = pos; i < pos + how_many; ++i)
+    {
+        const auto digit = static_cast<unsigned char>(text[i]) - '0';
+        if (digit > 9)
+        {
+            return false;
+        }
+        value = value * 10 + static_cast<int32_t>(digit);
+    }
+    return true;
+}
+
+// YYYY-MM-DD. Like from_stream, anything after the date is ignored.
+
+std::optional<std::chrono::year_month_day> ParseISODate(std::string_view the_date)
+{
+    int32_t y = 0;
+    int32_t m = 0;
+    int32_t d = 0;
+    if (the_date.size() < 10 || !ReadDigits(the_date, 0, 4, y) || the_date[4] != '-' ||
+        !ReadDigits(the_date, 5, 2, m) || the_date[7] != '-' || !ReadDigits(the_date, 8, 2, d))
+    {
+        return std::nullopt;
+    }
+    std::chrono::year_month_day result{std::chrono::year{y}, std::chrono::month(m), std::chrono::day(d)};
+    if (!result.ok())
+    {
+        return std::nullopt;
+    }
+    return result;
+}
+
+std::optional<std::chrono::utc_time<std::chrono::nanoseconds>> ParseISOTimePoint(const ISOTimeFormat &format,
+                                                                                 std::string_view the_date)
+{
+    const auto ymd = ParseISODate(the_date);
+    if (!ymd)
+    {
+        return std::nullopt;
+    }
+    std::chrono::sys_time<std::chrono::nanoseconds> result{std::chrono::sys_days{*ymd}};
+    if (!format.has_time_)
+    {
+        return std::chrono::utc_clock::from_sys(result);
+    }
+
+    int32_t hh = 0;
+    int32_t mm = 0;
+    int32_t ss = 0;
+    if (the_date.size() < 19 || the_date[10] != format.separator_ || !ReadDigits(the_date, 11, 2, hh) ||
+        the_date[13] != ':' || !ReadDigits(the_date, 14, 2, mm) || the_date[16] != ':' ||
+        !ReadDigits(the_date, 17, 2, ss) || hh > 23 || mm > 59 || ss > 59)
+    {
+        return std::nullopt;
+    }
+    result += std::chrono::hours{hh} + std::chrono::minutes{mm} + std::chrono::seconds{ss};
+
+    // optional fraction, up to nanoseconds.
+
+    size_t pos = 19;
+    if (pos < the_date.size() && the_date[pos] == '.')
+    {
+        ++pos;
+        int64_t fraction = 0;
+        size_t how_many_digits = 0;
+        while (pos < the_date.size() && the_date[pos] >= '0' && the_date[pos] <= '9')
+        {
+            if (++how_many_digits > 9)
+            {
+                return std::nullopt;
+            }
+            fraction = fraction * 10 + (the_date[pos++] - '0');
+        }
+        if (how_many_digits == 0)
+        {
+            return std::nullopt;
+        }
+        for (; how_many_digits < 9; ++how_many_digits)
+        {
+            fraction *= 10;
+        }
+        result += std::chrono::nanoseconds{fraction};
+    }
+
+    switch (format.zone_suffix_)
+    {
+        using enum ISOZoneSuffix;
+        case e_None:
+            break;
+
+        case e_Z:
+            if (pos == the_date.size() || the_date[pos] != 'Z')
+            {
+                return std::nullopt;
+            }
+            break;
+
+        case e_Offset:
+        case e_OffsetWithColon: {
+            // +hhmm or +hh:mm
+
+            if (pos == the_date.size() || (the_date[pos] != '+' && the_date[pos] != '-'))
+            {
+                return std::nullopt;
+            }
+            const int32_t sign = the_date[pos] == '-' ? -1 : 1;
+            const size_t minutes_pos = format.zone_suffix_ == e_Offset ? pos + 3 : pos + 4;
+            int32_t offset_hh = 0;
+            int32_t offset_mm = 0;
+            const bool colon_ok = format.zone_suffix_ == e_Offset ||
+                                  (pos + 3 < the_date.size() && the_date[pos + 3] == ':');
+            if (!ReadDigits(the_date, pos + 1, 2, offset_hh) || !colon_ok ||
+                !ReadDigits(the_date, minutes_pos, 2, offset_mm) || offset_mm > 59)
+            {
+                return std::nullopt;
+            }
+            result -= sign * (std::chrono::hours{offset_hh} + std::chrono::minutes{offset_mm});
+            break;
+        }
+    };
+    return std::chrono::utc_clock::from_sys(result);
+}
+} // namespace
+
 // ===  FUNCTION  ======================================================================
 //         Name:  StringToTimePoint
 //  Description:
@@ -115,7 +335,21 @@ std::string UTCTimePointToLocalTZHMSString(std::chrono::utc_clock::time_point a_
 std::chrono::utc_time<std::chrono::nanoseconds> StringToUTCTimePoint(std::string_view input_format,
                                                                      std::string_view the_date)
 {
-    std::istringstream in{the_date.data()};
+    INSTRUMENT_TIMER(timer, "string_to_utc_time_point", "");
+
+    if (const auto iso_format = MatchISOTimeFormat(input_format); iso_format)
+    {
+        if (auto result = ParseISOTimePoint(*iso_format, the_date); result)
+        {
+            return *result;
+        }
+    }
+
+    // not one we can do quickly. NOTE: BOOST_ASSERT_MSG only builds the message if the test fails.
+
+    INSTRUMENT_COUNT("string_to_utc_time_point_slow_path", 1);
+
+    std::istringstream in{std::string{the_date}};
     std::chrono::utc_clock::time_point tp;
     std::chrono::from_stream(in, input_format.data(), tp);
     BOOST_ASSERT_MSG(!in.fail() && !in.bad(), std::format("Unable to parse given date: {}", the_date).c_str());
@@ -131,7 +365,21 @@ std::chrono::utc_time<std::chrono::nanoseconds> StringToUTCTimePoint(std::string
 
 std::chrono::year_month_day StringToDateYMD(std::string_view input_format, std::string_view the_date)
 {
-    std::istringstream in{the_date.data()};
+    INSTRUMENT_TIMER(timer, "string_to_date_ymd", "");
+
+    if (input_format == "%Y-%m-%d")
+    {
+        if (auto result = ParseISODate(the_date); result)
+        {
+            return *result;
+        }
+    }
+
+    // not one we can do quickly. NOTE: BOOST_ASSERT_MSG only builds the message if the test fails.
+
+    INSTRUMENT_COUNT("string_to_date_ymd_slow_path", 1);
+
+    std::istringstream in{std::string{the_date}};
     std::chrono::year_month_day result{};
     std::chrono::from_stream(in, input_format.data(), result);
     BOOST_ASSERT_MSG(!in.fail() && !in.bad(), std::format("Unable to parse given date: {}", the_date).c_str());
@@ -147,28 +395,19 @@ std::chrono::year_month_day StringToDateYMD(std::string_view input_format, std::
 // =====================================================================================
 bool IsUS_MarketOpen(const std::chrono::year_month_day &a_day)
 {
-    // look for holidays and weekends
-    // start with weekends
+    // weekends and holidays are already accounted for in the calendar.
 
-    std::chrono::weekday d1{std::chrono::sys_days{a_day}};
-    if (d1 == std::chrono::Saturday || d1 == std::chrono::Sunday)
-    {
-        return false;
-    }
-
-    auto holidays = MakeHolidayList(a_day.year());
-    return rng::find(holidays, a_day, [](const auto &e) { return e.second; }) == holidays.end();
+    return GetUS_TradingCalendar().IsTradingDay(a_day);
 } // -----  end of function IsUS_MarketOpen  -----
 
-// ===  FUNCTION  ======================================================================
-//         Name:  ConstructeBusinessDayList
-//  Description:  Generate a start/end pair of dates which included n business days
-//                skipping holidays.
-// =====================================================================================
+namespace
+{
+// the list building is the same whichever vector we fill so the std:: and std::pmr::
+// versions below share these.
 
-std::vector<std::chrono::year_month_day> ConstructeBusinessDayList(std::chrono::year_month_day start_from,
-                                                                   size_t how_many_business_days, UpOrDown order,
-                                                                   const US_MarketHolidays *holidays)
+template <typename DayList>
+DayList FillBusinessDayList(DayList business_days, std::chrono::year_month_day start_from,
+                            size_t how_many_business_days, UpOrDown order, const US_MarketHolidays *holidays)
 {
     // we need to do some date arithmetic so we can use our basic 'GetTickerData' method.
 
@@ -176,7 +415,7 @@ std::vector<std::chrono::year_month_day> ConstructeBusinessDayList(std::chrono::
 
     const std::chrono::days day_increment{order == UpOrDown::e_Up ? 1 : -1};
 
-    std::vector<std::chrono::year_month_day> business_days;
+    business_days.reserve(how_many_business_days);
 
     auto IsHoliday = [holidays](const std::chrono::year_month_day &a_day) {
         if (holidays == nullptr)
@@ -201,6 +440,75 @@ std::vector<std::chrono::year_month_day> ConstructeBusinessDayList(std::chrono::
     // std::print("\nBusiness days found: {}\n{}\n\n", business_days, business_days.size());
 
     return business_days;
+}
+
+template <typename DayList>
+DayList FillBusinessDayList(DayList business_days, std::chrono::year_month_day start_from,
+                            size_t how_many_business_days, UpOrDown order, const TradingCalendar &calendar)
+{
+    auto days = std::chrono::sys_days{start_from};
+
+    const std::chrono::days day_increment{order == UpOrDown::e_Up ? 1 : -1};
+
+    business_days.reserve(how_many_business_days);
+
+    while (business_days.size() < how_many_business_days)
+    {
+        if (calendar.IsTradingDay(days))
+        {
+            business_days.emplace_back(days);
+        }
+        days += day_increment;
+    }
+
+    return business_days;
+}
+} // namespace
+
+// ===  FUNCTION  ======================================================================
+//         Name:  ConstructeBusinessDayList
+//  Description:  Generate a start/end pair of dates which included n business days
+//                skipping holidays.
+// =====================================================================================
+
+std::vector<std::chrono::year_month_day> ConstructeBusinessDayList(std::chrono::year_month_day start_from,
+                                                                   size_t how_many_business_days, UpOrDown order,
+                                                                   const US_MarketHolidays *holidays)
+{
+    return FillBusinessDayList(std::vector<std::chrono::year_month_day>{}, start_from, how_many_business_days, order,
+                               holidays);
+} // -----  end of function ConstructeBusinessDayList  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  ConstructeBusinessDayList
+//  Description:  Generate a list of n business days using a precomputed trading
+//                calendar.
+// =====================================================================================
+
+std::vector<std::chrono::year_month_day> ConstructeBusinessDayList(std::chrono::year_month_day start_from,
+                                                                   size_t how_many_business_days, UpOrDown order,
+                                                                   const TradingCalendar &calendar)
+{
+    return FillBusinessDayList(std::vector<std::chrono::year_month_day>{}, start_from, how_many_business_days, order,
+                               calendar);
+} // -----  end of function ConstructeBusinessDayList  -----
+
+std::pmr::vector<std::chrono::year_month_day> ConstructeBusinessDayList(std::chrono::year_month_day start_from,
+                                                                        size_t how_many_business_days, UpOrDown order,
+                                                                        const US_MarketHolidays *holidays,
+                                                                        std::pmr::memory_resource *resource)
+{
+    return FillBusinessDayList(std::pmr::vector<std::chrono::year_month_day>{resource}, start_from,
+                               how_many_business_days, order, holidays);
+} // -----  end of function ConstructeBusinessDayList  -----
+
+std::pmr::vector<std::chrono::year_month_day> ConstructeBusinessDayList(std::chrono::year_month_day start_from,
+                                                                        size_t how_many_business_days, UpOrDown order,
+                                                                        const TradingCalendar &calendar,
+                                                                        std::pmr::memory_resource *resource)
+{
+    return FillBusinessDayList(std::pmr::vector<std::chrono::year_month_day>{resource}, start_from,
+                               how_many_business_days, order, calendar);
 } // -----  end of function ConstructeBusinessDayList  -----
 
 // ===  FUNCTION  ======================================================================
@@ -214,14 +522,70 @@ std::pair<std::chrono::year_month_day, std::chrono::year_month_day> ConstructeBu
     const US_MarketHolidays *holidays)
 {
     // we need to do some date arithmetic so we can use our basic 'GetTickerData' method.
+    // we only need the end points so just count our way there instead of building the list.
+
+    BOOST_ASSERT_MSG(how_many_business_days > 0,
+                     std::format("Number of business days must be positive: {}", how_many_business_days).c_str());
 
     auto days = std::chrono::sys_days{start_from};
 
     const std::chrono::days day_increment{order == UpOrDown::e_Up ? 1 : -1};
 
-    auto business_days = ConstructeBusinessDayList(start_from, how_many_business_days, order, holidays);
+    auto IsBusinessDay = [holidays](std::chrono::sys_days a_day) {
+        auto b_day = std::chrono::weekday{a_day};
+        if (b_day == std::chrono::Saturday || b_day == std::chrono::Sunday)
+        {
+            return false;
+        }
+        if (holidays == nullptr)
+        {
+            return true;
+        }
+        return rng::find(*holidays, std::chrono::year_month_day{a_day}, [](const auto &e) { return e.second; }) ==
+               holidays->end();
+    };
+
+    while (!IsBusinessDay(days))
+    {
+        days += day_increment;
+    }
+    const auto first_business_day = days;
+
+    for (int how_many = 1; how_many < how_many_business_days;)
+    {
+        days += day_increment;
+        if (IsBusinessDay(days))
+        {
+            ++how_many;
+        }
+    }
 
-    return {business_days.front(), business_days.back()};
+    return {first_business_day, days};
+} // -----  end of function ConstructeBusinessDayRange  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  ConstructeBusinessDayRange
+//  Description:  Same as above but uses the trading calendar's indexes so it's O(1).
+// =====================================================================================
+
+std::pair<std::chrono::year_month_day, std::chrono::year_month_day> ConstructeBusinessDayRange(
+    std::chrono::year_month_day start_from, int how_many_business_days, UpOrDown order,
+    const TradingCalendar &calendar)
+{
+    BOOST_ASSERT_MSG(how_many_business_days > 0,
+                     std::format("Number of business days must be positive: {}", how_many_business_days).c_str());
+
+    const int32_t direction = order == UpOrDown::e_Up ? 1 : -1;
+
+    auto first_business_day = std::chrono::sys_days{start_from};
+    if (!calendar.IsTradingDay(first_business_day))
+    {
+        first_business_day = calendar.AddBusinessDays(first_business_day, direction);
+    }
+    const auto last_business_day =
+        calendar.AddBusinessDays(first_business_day, direction * (how_many_business_days - 1));
+
+    return {first_business_day, last_business_day};
 } // -----  end of function ConstructeBusinessDayRange  -----
 
 /*
@@ -232,82 +596,250 @@ std::pair<std::chrono::year_month_day, std::chrono::year_month_day> ConstructeBu
  */
 std::string LoadDataFileForUse(const fs::path &file_name)
 {
-    std::string file_content; // make room for trailing null
-    file_content.reserve(fs::file_size(file_name) + 1);
+    INSTRUMENT_TIMER(timer, "load_data_file_for_use", "bytes");
+
     std::ifstream input_file{file_name, std::ios_base::in | std::ios_base::binary};
     BOOST_ASSERT_MSG(input_file.is_open(), std::format("Can't open data file: {}.", file_name).c_str());
-    //    input_file.read(&file_content[0], file_content.size());
-    file_content.assign(std::istreambuf_iterator<char>(input_file), std::istreambuf_iterator<char>());
+
+    std::string file_content;
+
+    // if we know the size up front we can do it all in one read.
+
+    std::error_code ec;
+    if (const auto file_size = fs::file_size(file_name, ec); !ec && file_size > 0)
+    {
+        file_content.resize(file_size);
+        input_file.read(file_content.data(), static_cast<std::streamsize>(file_size));
+        file_content.resize(static_cast<size_t>(input_file.gcount()));
+    }
+
+    // pipes and such don't have a size so read whatever is (still) there in big chunks.
+
+    std::array<char, 64 * 1024> buffer;
+    while (input_file.read(buffer.data(), buffer.size()) || input_file.gcount() > 0)
+    {
+        file_content.append(buffer.data(), static_cast<size_t>(input_file.gcount()));
+    }
     input_file.close();
 
+    INSTRUMENT_TIMER_WORK(timer, file_content.size());
     return file_content;
 } /* -----  end of function LoadDataFileForUse  ----- */
 
 Json::Value ReadAndParsePF_ChartJSONFile(const fs::path &file_name)
 {
-    BOOST_ASSERT_MSG(fs::exists(file_name), std::format("Unable to find JSON file: {}", file_name).c_str());
+    INSTRUMENT_TIMER(timer, "read_and_parse_json_file", "");
+
+    // one stat answers both questions.
+
+    const auto file_status = fs::status(file_name);
+    BOOST_ASSERT_MSG(fs::exists(file_status), std::format("Unable to find JSON file: {}", file_name).c_str());
+
+    // regular files are parsed straight from the mapping. anything else we have to read in.
+
+    if (fs::is_regular_file(file_status))
+    {
+        const MappedFile mapped_file{file_name};
+        return ParseJSONData(mapped_file.AsStringView());
+    }
 
     const std::string file_content = LoadDataFileForUse(file_name);
+    return ParseJSONData(file_content);
+} // -----  end of method ReadAndParseJSONFile  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  ParseJSONData
+//  Description:
+// =====================================================================================
+
+Json::Value ParseJSONData(std::string_view json_data)
+{
+    INSTRUMENT_TIMER(timer, "parse_json_data", "bytes");
+    INSTRUMENT_TIMER_WORK(timer, json_data.size());
 
     JSONCPP_STRING err;
     Json::Value JSON_data;
 
     Json::CharReaderBuilder builder;
     const std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
-    if (!reader->parse(file_content.data(), file_content.data() + file_content.size(), &JSON_data, &err))
+    if (!reader->parse(json_data.data(), json_data.data() + json_data.size(), &JSON_data, &err))
     {
         throw std::runtime_error(std::format("Problem parsing test data file: {}", err));
     }
     return JSON_data;
-} // -----  end of method ReadAndParseJSONFile  -----
+} // -----  end of function ParseJSONData  -----
 
 // ===  FUNCTION  ======================================================================
 //         Name:  ConvertJSONPriceHistory
 //         Description:  Expects the input data is in descending order by date
+//                       Stays on the calling thread. Callers such as LoadJSONFilesInParallel
+//                       already have a thread per file.
 // =====================================================================================
 
 std::vector<StockDataRecord> ConvertJSONPriceHistory(const std::string &symbol, const Json::Value &the_data,
                                                      uint32_t how_many_days, UseAdjusted use_adjusted)
+{
+    return ConvertJSONPriceHistory(symbol, the_data, how_many_days, use_adjusted, 1U);
+} // -----  end of function ConvertJSONPriceHistory  -----
+
+namespace
+{
+// fills history[first, last) from the same rows of the JSON data. 'history' is already
+// sized.  Works for StockDataRecord and PMR_StockDataRecord.
+
+template <typename History>
+void ConvertJSONPriceRows(const std::string &symbol, const Json::Value &the_data, UseAdjusted use_adjusted,
+                          History &history, Json::ArrayIndex first, Json::ArrayIndex last)
+{
+    const bool adjusted = use_adjusted == UseAdjusted::e_Yes;
+    const char *open_key = adjusted ? "adjOpen" : "open";
+    const char *high_key = adjusted ? "adjHigh" : "high";
+    const char *low_key = adjusted ? "adjLow" : "low";
+    const char *close_key = adjusted ? "adjClose" : "close";
+
+    for (Json::ArrayIndex i = first; i < last; ++i)
+    {
+        const auto &row = the_data[i];
+        auto &record = history[i];
+        record.date_ = row["date"].asCString();
+        record.symbol_ = symbol;
+        record.open_ = StringToDecimal(row[open_key].asCString());
+        record.high_ = StringToDecimal(row[high_key].asCString());
+        record.low_ = StringToDecimal(row[low_key].asCString());
+        record.close_ = StringToDecimal(row[close_key].asCString());
+    }
+}
+} // namespace
+
+// ===  FUNCTION  ======================================================================
+//         Name:  ConvertJSONPriceHistory
+//  Description:  The output is sized up front and each thread fills in its own
+//                contiguous block of rows so the order is the same as the input no
+//                matter how many threads we use.  Reading a const Json::Value from
+//                several threads is safe.
+// =====================================================================================
+
+std::vector<StockDataRecord> ConvertJSONPriceHistory(const std::string &symbol, const Json::Value &the_data,
+                                                     uint32_t how_many_days, UseAdjusted use_adjusted,
+                                                     uint32_t thread_count)
 {
     if (!the_data.isArray() || the_data.empty())
     {
         return {};
     }
-    std::vector<StockDataRecord> history;
 
-    auto how_many = std::min(how_many_days, the_data.size());
+    // below this many rows per thread, starting a thread costs more than it saves.
+
+    constexpr uint32_t min_rows_per_thread = 1024;
+
+    const auto how_many = std::min(how_many_days, the_data.size());
+    std::vector<StockDataRecord> history(how_many);
+
+    INSTRUMENT_TIMER(timer, "convert_json_price_history", "rows");
+    INSTRUMENT_TIMER_WORK(timer, how_many);
 
-    if (use_adjusted == UseAdjusted::e_Yes)
+    auto convert_rows = [&](Json::ArrayIndex first, Json::ArrayIndex last) {
+        ConvertJSONPriceRows(symbol, the_data, use_adjusted, history, first, last);
+    };
+
+    if (thread_count == 0)
+    {
+        thread_count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    thread_count = std::clamp(how_many / min_rows_per_thread, 1U, thread_count);
+
+    if (thread_count == 1)
+    {
+        convert_rows(0, how_many);
+        return history;
+    }
+
+    // exceptions can't leave a thread so we carry them back and rethrow the first one.
+
+    const auto rows_per_thread = (how_many + thread_count - 1) / thread_count;
+    std::vector<std::exception_ptr> problems(thread_count);
     {
-        for (int32_t i = 0; i < how_many; ++i)
+        std::vector<std::jthread> workers;
+        workers.reserve(thread_count);
+        for (uint32_t t = 0; t < thread_count; ++t)
         {
-            StockDataRecord record;
-            record.date_ = the_data[i]["date"].asCString();
-            record.symbol_ = symbol;
-            record.open_ = Decimal{the_data[i]["adjOpen"].asCString()};
-            record.high_ = Decimal{the_data[i]["adjHigh"].asCString()};
-            record.low_ = Decimal{the_data[i]["adjLow"].asCString()};
-            record.close_ = Decimal{the_data[i]["adjClose"].asCString()};
-            history.push_back(std::move(record));
+            const auto first = std::min(how_many, t * rows_per_thread);
+            const auto last = std::min(how_many, first + rows_per_thread);
+            workers.emplace_back([&convert_rows, &problem = problems[t], first, last] {
+                try
+                {
+                    convert_rows(first, last);
+                }
+                catch (...)
+                {
+                    problem = std::current_exception();
+                }
+            });
         }
     }
-    else
+    for (const auto &problem : problems)
     {
-        for (int32_t i = 0; i < how_many; ++i)
+        if (problem)
         {
-            StockDataRecord record;
-            record.date_ = the_data[i]["date"].asCString();
-            record.symbol_ = symbol;
-            record.open_ = Decimal{the_data[i]["open"].asCString()};
-            record.high_ = Decimal{the_data[i]["high"].asCString()};
-            record.low_ = Decimal{the_data[i]["low"].asCString()};
-            record.close_ = Decimal{the_data[i]["close"].asCString()};
-            history.push_back(std::move(record));
+            std::rethrow_exception(problem);
         }
     }
     return history;
 } // -----  end of function ConvertJSONPriceHistory  -----
 
+// ===  FUNCTION  ======================================================================
+//         Name:  ConvertJSONPriceHistoryPMR
+//  Description:  sizing the pmr::vector gives each record our resource so the
+//                strings assigned below are allocated from it too.
+// =====================================================================================
+
+std::pmr::vector<PMR_StockDataRecord> ConvertJSONPriceHistoryPMR(const std::string &symbol,
+                                                                 const Json::Value &the_data, uint32_t how_many_days,
+                                                                 UseAdjusted use_adjusted,
+                                                                 std::pmr::memory_resource *resource)
+{
+    if (!the_data.isArray() || the_data.empty())
+    {
+        return std::pmr::vector<PMR_StockDataRecord>{resource};
+    }
+
+    const auto how_many = std::min(how_many_days, the_data.size());
+    std::pmr::vector<PMR_StockDataRecord> history(how_many, resource);
+
+    INSTRUMENT_TIMER(timer, "convert_json_price_history", "rows");
+    INSTRUMENT_TIMER_WORK(timer, how_many);
+
+    ConvertJSONPriceRows(symbol, the_data, use_adjusted, history, 0, how_many);
+    return history;
+} // -----  end of function ConvertJSONPriceHistoryPMR  -----
+
+// ===  FUNCTION  ======================================================================
+//         Name:  ParseJSONPriceHistory
+//         Description:  Reads the rows directly from the JSON text.  We stop reading
+//                       as soon as we have as many rows as requested.
+// =====================================================================================
+
+std::vector<StockDataRecord> ParseJSONPriceHistory(const std::string &symbol, std::string_view json_text,
+                                                   uint32_t how_many_days, UseAdjusted use_adjusted)
+{
+    std::vector<StockDataRecord> history;
+
+    PriceHistoryJSONReader reader{json_text, use_adjusted};
+    PriceHistoryJSONRow row;
+    while (history.size() < how_many_days && reader.NextRow(row))
+    {
+        StockDataRecord record;
+        record.date_ = row.date_;
+        record.symbol_ = symbol;
+        record.open_ = reader.FieldToDecimal(row.open_);
+        record.high_ = reader.FieldToDecimal(row.high_);
+        record.low_ = reader.FieldToDecimal(row.low_);
+        record.close_ = reader.FieldToDecimal(row.close_);
+        history.push_back(std::move(record));
+    }
+    return history;
+} // -----  end of function ParseJSONPriceHistory  -----
+
 namespace boost
 {
 // these functions are declared in the library headers but left to the user to define.
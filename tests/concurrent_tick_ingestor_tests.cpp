@@ -0,0 +1,158 @@
+/* =====================================================================================
+ *
+ * Filename:  concurrent_tick_ingestor_tests.cpp
+ *
+ * Description:  Multi producer stress tests for ConcurrentTickIngestor: every tick
+ *               arrives exactly once and in the order each producer pushed it, and
+ *               summaries are never read half written.
+ *
+ * Version:  1.0
+ * Created:  2026-10-18 10:03:51
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "concurrent_tick_ingestor.h"
+
+namespace
+{
+constexpr int32_t how_many_producers = 4;
+constexpr SymbolID how_many_symbols = 3;
+constexpr int64_t ticks_per_producer_per_symbol = 20'000;
+
+// each tick is tagged: the signal type is the producer and the timestamp is that
+// producer's sequence number for the symbol. The price encodes both so a summary
+// read can be checked for consistency.
+
+double TagPrice(int32_t producer, int64_t sequence)
+{
+    return static_cast<double>(producer) * 1'000'000.0 + static_cast<double>(sequence);
+}
+} // namespace
+
+TEST(ConcurrentTickIngestor, EveryTickOnceInProducerOrder)
+{
+    // a small queue so producers regularly find it full and have to retry.
+
+    ConcurrentTickIngestor ingestor{how_many_symbols, 64};
+
+    std::atomic<bool> done_producing{false};
+    std::atomic<int64_t> torn_summaries{0};
+
+    // next_expected[symbol][producer]
+    std::vector<std::vector<int64_t>> next_expected(how_many_symbols, std::vector<int64_t>(how_many_producers, 0));
+    int64_t out_of_order = 0;
+    int64_t received = 0;
+
+    std::jthread consumer{[&] {
+        auto drain_all = [&] {
+            const auto received_before = received;
+            for (SymbolID id = 0; id < how_many_symbols; ++id)
+            {
+                received += static_cast<int64_t>(ingestor.DrainTicks(id, [&](const StreamedTick &tick) {
+                    auto &expected = next_expected[id][tick.signal_type_];
+                    if (tick.timestamp_seconds_ != expected ||
+                        tick.price_ != TagPrice(tick.signal_type_, tick.timestamp_seconds_))
+                    {
+                        ++out_of_order;
+                    }
+                    expected = tick.timestamp_seconds_ + 1;
+                }));
+            }
+            return received > received_before;
+        };
+        while (!done_producing.load(std::memory_order_acquire))
+        {
+            if (!drain_all())
+            {
+                std::this_thread::yield();
+            }
+        }
+        drain_all();
+    }};
+
+    // readers check each summary's price matches its signal type: a torn read would mix
+    // 2 different ticks.
+
+    std::jthread reader{[&] {
+        while (!done_producing.load(std::memory_order_acquire))
+        {
+            for (SymbolID id = 0; id < how_many_symbols; ++id)
+            {
+                const auto summary = ingestor.GetSummary(id);
+                if (summary.latest_price_ != 0.0 &&
+                    static_cast<int32_t>(summary.latest_price_ / 1'000'000.0) != summary.curent_signal_type_)
+                {
+                    ++torn_summaries;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }};
+
+    {
+        std::vector<std::jthread> producers;
+        for (int32_t producer = 0; producer < how_many_producers; ++producer)
+        {
+            producers.emplace_back([&, producer] {
+                for (int64_t sequence = 0; sequence < ticks_per_producer_per_symbol; ++sequence)
+                {
+                    for (SymbolID id = 0; id < how_many_symbols; ++id)
+                    {
+                        const StreamedTick tick{sequence, TagPrice(producer, sequence), producer};
+                        while (!ingestor.PushTick(id, tick))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+            });
+        }
+    }
+    done_producing.store(true, std::memory_order_release);
+    consumer.join();
+    reader.join();
+
+    EXPECT_EQ(received, int64_t{how_many_producers} * how_many_symbols * ticks_per_producer_per_symbol);
+    EXPECT_EQ(out_of_order, 0);
+    EXPECT_EQ(torn_summaries.load(), 0);
+    for (const auto &per_symbol : next_expected)
+    {
+        for (const auto next : per_symbol)
+        {
+            EXPECT_EQ(next, ticks_per_producer_per_symbol);
+        }
+    }
+}
+
+TEST(ConcurrentTickIngestor, FullQueueDropsTickButUpdatesSummary)
+{
+    ConcurrentTickIngestor ingestor{1, 4};
+    for (int64_t i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ingestor.PushTick(0, {i, 10.0 + static_cast<double>(i), 0}));
+    }
+    EXPECT_FALSE(ingestor.PushTick(0, {4, 20.0, 1}));
+
+    const auto summary = ingestor.GetSummary(0);
+    EXPECT_EQ(summary.opening_price_, 10.0);
+    EXPECT_EQ(summary.latest_price_, 20.0);
+    EXPECT_EQ(summary.curent_signal_type_, 1);
+
+    std::vector<int64_t> timestamps;
+    EXPECT_EQ(ingestor.DrainTicks(0, [&](const StreamedTick &tick) { timestamps.push_back(tick.timestamp_seconds_); }),
+              4U);
+    EXPECT_EQ(timestamps, (std::vector<int64_t>{0, 1, 2, 3}));
+}
@@ -0,0 +1,233 @@
+/* =====================================================================================
+ *
+ * Filename:  date_close_grouper_tests.cpp
+ *
+ * Description:  DateCloseGrouper, in memory and spilling sorted runs to disk,
+ *               against std::stable_sort on (first seen symbol, date).  Equal keys
+ *               must keep the order they were added in.
+ *
+ * Version:  1.0
+ * Created:  2026-10-18 18:12:40
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "date_close_grouper.h"
+
+namespace
+{
+using UTC_TimePoint = GroupedDateCloses::UTC_TimePoint;
+
+// each close is the row's position in the input so we can see rows with equal keys
+// come out in the order they went in.
+
+struct ExpectedRow
+{
+    UTC_TimePoint date_;
+    Decimal close_;
+};
+
+struct Expected
+{
+    std::vector<std::string> symbols_;             // in the order first seen
+    std::vector<std::vector<ExpectedRow>> series_; // one per symbol, same order
+};
+
+UTC_TimePoint MakeDate(std::chrono::sys_days day)
+{
+    return std::chrono::utc_clock::from_sys(day);
+}
+
+// a date range which straddles 1970 so the dates' keys have both signs, and is short
+// enough that the same symbol and date turns up many times.
+
+std::vector<MultiSymbolDateCloseRecord> MakeRecords(size_t how_many, uint32_t seed)
+{
+    constexpr std::chrono::sys_days first_day{std::chrono::year{1969} / 3 / 1};
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<int32_t> which_symbol{0, 19};
+    std::uniform_int_distribution<int32_t> which_day{0, 800};
+
+    std::vector<MultiSymbolDateCloseRecord> result;
+    result.reserve(how_many);
+    for (size_t i = 0; i < how_many; ++i)
+    {
+        result.push_back({std::format("SYM{:02}", which_symbol(generator)),
+                          MakeDate(first_day + std::chrono::days{which_day(generator)}),
+                          Decimal{static_cast<int32_t>(i)}});
+    }
+
+    // and some well away from the epoch on either side.
+
+    result.push_back({"SYM00", MakeDate(std::chrono::year{1900} / 1 / 2), Decimal{-1}});
+    result.push_back({"SYM00", MakeDate(std::chrono::year{2100} / 1 / 4), Decimal{-2}});
+    return result;
+}
+
+Expected StableSortBySymbolAndDate(std::span<const MultiSymbolDateCloseRecord> records)
+{
+    Expected expected;
+    std::vector<std::pair<size_t, const MultiSymbolDateCloseRecord *>> rows;
+    for (const auto &record : records)
+    {
+        auto found = std::ranges::find(expected.symbols_, record.symbol_);
+        if (found == expected.symbols_.end())
+        {
+            expected.symbols_.push_back(record.symbol_);
+            found = expected.symbols_.end() - 1;
+        }
+        rows.emplace_back(static_cast<size_t>(found - expected.symbols_.begin()), &record);
+    }
+    std::ranges::stable_sort(rows, [](const auto &lhs, const auto &rhs) {
+        return std::tie(lhs.first, lhs.second->date_) < std::tie(rhs.first, rhs.second->date_);
+    });
+
+    expected.series_.resize(expected.symbols_.size());
+    for (const auto &[symbol, record] : rows)
+    {
+        expected.series_[symbol].push_back({record->date_, record->close_});
+    }
+    return expected;
+}
+
+void ExpectSeries(const ExpectedRow *first, size_t how_many, std::span<const UTC_TimePoint> dates,
+                  std::span<const Decimal> closes, std::string_view symbol)
+{
+    ASSERT_EQ(dates.size(), how_many) << "symbol: " << symbol;
+    ASSERT_EQ(closes.size(), how_many) << "symbol: " << symbol;
+    for (size_t i = 0; i < how_many; ++i)
+    {
+        ASSERT_EQ(dates[i], first[i].date_) << "symbol: " << symbol << " row: " << i;
+        ASSERT_TRUE(closes[i] == first[i].close_) << "symbol: " << symbol << " row: " << i;
+    }
+}
+
+void ExpectGrouped(const Expected &expected, const GroupedDateCloses &grouped)
+{
+    ASSERT_EQ(grouped.GetSymbolCount(), expected.symbols_.size());
+    for (SymbolID id = 0; id < grouped.GetSymbolCount(); ++id)
+    {
+        ASSERT_EQ(grouped.GetSymbol(id), expected.symbols_[id]);
+        const auto &series = expected.series_[id];
+        ExpectSeries(series.data(), series.size(), grouped.GetDates(id), grouped.GetCloses(id), grouped.GetSymbol(id));
+    }
+}
+
+// a directory of our own so we can check the run files are cleaned up.
+
+class TemporaryDirectory
+{
+public:
+    TemporaryDirectory()
+        : path_{fs::temp_directory_path() / std::format("date_close_grouper_tests_{}", getpid())}
+    {
+        fs::create_directories(path_);
+    }
+    TemporaryDirectory(const TemporaryDirectory &rhs) = delete;
+    ~TemporaryDirectory()
+    {
+        std::error_code ec;
+        fs::remove_all(path_, ec);
+    }
+
+    [[nodiscard]] const fs::path &GetPath() const
+    {
+        return path_;
+    }
+
+    TemporaryDirectory &operator=(const TemporaryDirectory &rhs) = delete;
+
+private:
+    fs::path path_;
+};
+
+// rows are 24 bytes and the budget covers them twice over, so this is 4'096 rows a run,
+// well above the 1'024 row floor.  With 4'096 rows a run and a few runs, the merge reads
+// each run in several blocks.
+
+DateCloseGrouperOptions SpillingOptions(const fs::path &directory)
+{
+    return {.memory_budget_bytes_ = 4'096 * 2 * 24, .temporary_directory_ = directory};
+}
+
+constexpr size_t how_many_spilled = 30'000;
+} // namespace
+
+TEST(DateCloseGrouper, GroupBySymbolMatchesStableSort)
+{
+    const auto records = MakeRecords(20'000, 20261018);
+    ExpectGrouped(StableSortBySymbolAndDate(records), GroupBySymbol(records));
+}
+
+TEST(DateCloseGrouper, SpilledFinishMatchesStableSort)
+{
+    const auto records = MakeRecords(how_many_spilled, 20261019);
+    const auto expected = StableSortBySymbolAndDate(records);
+
+    const TemporaryDirectory directory;
+    DateCloseGrouper grouper{SpillingOptions(directory.GetPath())};
+    grouper.Add(records);
+    EXPECT_GE(grouper.GetRunCount(), 5U);
+
+    ExpectGrouped(expected, grouper.Finish());
+    EXPECT_TRUE(fs::is_empty(directory.GetPath()));
+}
+
+TEST(DateCloseGrouper, SpilledFinishWithHandlerMatchesStableSort)
+{
+    const auto records = MakeRecords(how_many_spilled, 20261020);
+    const auto expected = StableSortBySymbolAndDate(records);
+
+    const TemporaryDirectory directory;
+    DateCloseGrouper grouper{SpillingOptions(directory.GetPath())};
+    grouper.Add(records);
+    EXPECT_GE(grouper.GetRunCount(), 5U);
+
+    size_t next_symbol = 0;
+    grouper.Finish([&](std::string_view symbol, std::span<const UTC_TimePoint> dates, std::span<const Decimal> closes) {
+        ASSERT_LT(next_symbol, expected.symbols_.size());
+        EXPECT_EQ(symbol, expected.symbols_[next_symbol]);
+        const auto &series = expected.series_[next_symbol];
+        ExpectSeries(series.data(), series.size(), dates, closes, symbol);
+        ++next_symbol;
+    });
+    EXPECT_EQ(next_symbol, expected.symbols_.size());
+    EXPECT_TRUE(fs::is_empty(directory.GetPath()));
+    EXPECT_EQ(grouper.size(), 0U);
+}
+
+TEST(DateCloseGrouper, OneSymbolAndNoRows)
+{
+    const auto records = MakeRecords(3'000, 20261021);
+    std::vector<MultiSymbolDateCloseRecord> one_symbol;
+    std::ranges::copy_if(records, std::back_inserter(one_symbol),
+                         [](const auto &record) { return record.symbol_ == "SYM00"; });
+    ExpectGrouped(StableSortBySymbolAndDate(one_symbol), GroupBySymbol(one_symbol));
+
+    const auto grouped = GroupBySymbol({});
+    EXPECT_TRUE(grouped.empty());
+    EXPECT_EQ(grouped.GetSymbolCount(), 0U);
+}
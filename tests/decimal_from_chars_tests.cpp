@@ -0,0 +1,144 @@
+/* =====================================================================================
+ *
+ * Filename:  decimal_from_chars_tests.cpp
+ *
+ * Description:  DecimalFromChars against the general Boost Decimal parser: for any
+ *               input both must stop at the same place with the same error and, when
+ *               they succeed, give exactly the same bits.
+ *
+ * Version:  1.0
+ * Created:  2026-10-18 16:31:48
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <cstring>
+#include <format>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "decimal_from_chars.h"
+
+namespace
+{
+bool SameBits(const Decimal &lhs, const Decimal &rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(Decimal)) == 0;
+}
+
+// compare outcomes, not just values: inputs the general parser rejects (or only
+// partly parses) must be rejected (or partly parsed) the same way.  Both start
+// from the same value so a failed parse must leave it just as the general parser does.
+
+void ExpectSameAsGeneralParser(std::string_view text)
+{
+    const Decimal start{42};
+    const char *first = text.data();
+    const char *last = text.data() + text.size();
+
+    Decimal expected = start;
+    const auto [expected_ptr, expected_ec] = bd::from_chars(first, last, expected);
+
+    Decimal actual = start;
+    const auto [actual_ptr, actual_ec] = DecimalFromChars(first, last, actual);
+
+    ASSERT_EQ(actual_ec, expected_ec) << "text: '" << text << "'";
+    ASSERT_EQ(actual_ptr - first, expected_ptr - first) << "text: '" << text << "'";
+    ASSERT_TRUE(SameBits(actual, expected)) << "text: '" << text << "'";
+
+    // and the whole-string version: good only if all of 'text' was used.
+
+    const auto whole_expected_ec =
+        expected_ec != std::errc{} ? expected_ec
+                                   : (expected_ptr == last ? std::errc{} : std::errc::invalid_argument);
+    Decimal whole = start;
+    ASSERT_EQ(DecimalFromChars(text, whole), whole_expected_ec) << "text: '" << text << "'";
+    ASSERT_TRUE(SameBits(whole, whole_expected_ec == std::errc{} ? expected : start)) << "text: '" << text << "'";
+}
+
+std::string RandomDigits(std::mt19937_64 &generator, size_t how_many)
+{
+    std::uniform_int_distribution<int32_t> digit{0, 9};
+    std::string result;
+    for (; how_many > 0; --how_many)
+    {
+        result += static_cast<char>('0' + digit(generator));
+    }
+    return result;
+}
+} // namespace
+
+TEST(DecimalFromChars, EveryShortPrice)
+{
+    for (int32_t coefficient = 0; coefficient < 100'000; ++coefficient)
+    {
+        for (int32_t fractional_digits = 0; fractional_digits <= 5; ++fractional_digits)
+        {
+            auto text = std::format("{:0{}}", coefficient, fractional_digits + 1);
+            if (fractional_digits > 0)
+            {
+                text.insert(text.size() - static_cast<size_t>(fractional_digits), 1, '.');
+            }
+            ExpectSameAsGeneralParser(text);
+            ExpectSameAsGeneralParser("-" + text);
+        }
+    }
+}
+
+TEST(DecimalFromChars, RandomPricesUpToAndBeyond16Digits)
+{
+    std::mt19937_64 generator{20261018};
+    std::uniform_int_distribution<size_t> how_many_digits{1, 20};
+    for (int32_t i = 0; i < 1'000'000; ++i)
+    {
+        std::string text = i % 2 == 0 ? "" : "-";
+        text += RandomDigits(generator, how_many_digits(generator));
+        if (i % 3 != 0)
+        {
+            text += '.' + RandomDigits(generator, how_many_digits(generator));
+        }
+        ExpectSameAsGeneralParser(text);
+    }
+}
+
+TEST(DecimalFromChars, UnusualAndBadInput)
+{
+    for (const std::string_view text :
+         {"", "-", "+", ".", "-.", "0", "-0", "0.0", "-0.000", "00012.3400", "9999999999999999", "1e5", "-2.5E-3",
+          "1e", "+1.5", "+0", ".5", "-.5", "5.", "-5.", "12345678901234567", "0.00000000000000001", "1.2.3", "12abc",
+          "12.34 ", " 12.34", "abc", "nan", "-inf", "1,234.56", "--1", "12345678.12345678", "1234567.123456789"})
+    {
+        ExpectSameAsGeneralParser(text);
+    }
+}
+
+TEST(DecimalFromChars, Batch)
+{
+    const std::vector<std::string_view> fields{"1.5", "-2", "x", "3"};
+    std::vector<Decimal> values(fields.size(), Decimal{7});
+    EXPECT_EQ(DecimalFromChars(fields, values), 2U);
+    EXPECT_TRUE(SameBits(values[0], Decimal{"1.5"}));
+    EXPECT_TRUE(SameBits(values[1], Decimal{"-2"}));
+    EXPECT_TRUE(SameBits(values[2], Decimal{7}));
+
+    EXPECT_EQ(DecimalFromChars(std::span{fields}.first(2), values), 2U);
+}
+
+TEST(DecimalFromChars, StringToDecimal)
+{
+    EXPECT_TRUE(SameBits(StringToDecimal("123.45"), Decimal{"123.45"}));
+    EXPECT_THROW(StringToDecimal("123.45x"), std::runtime_error);
+    EXPECT_THROW(StringToDecimal(""), std::runtime_error);
+}
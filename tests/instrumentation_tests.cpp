@@ -0,0 +1,132 @@
+/* =====================================================================================
+ *
+ * Filename:  instrumentation_tests.cpp
+ *
+ * Description:  Histogram bucket bounds in the dumps, metrics recorded by threads
+ *               which have exited, and the limit on how many metrics there can be.
+ *               These call the functions directly so they work whether or not the
+ *               INSTRUMENT_... macros are compiled in.
+ *
+ * Version:  1.0
+ * Created:  2026-10-18 19:40:12
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "instrumentation.h"
+
+namespace
+{
+using namespace instrumentation;
+
+MetricSnapshot FindMetric(std::string_view name)
+{
+    const auto snapshot = TakeSnapshot();
+    const auto found = std::ranges::find(snapshot, name, &MetricSnapshot::name_);
+    return found == snapshot.end() ? MetricSnapshot{} : *found;
+}
+} // namespace
+
+TEST(Instrumentation, BucketBoundsAreInclusive)
+{
+    const auto id = RegisterMetric("bucket_bounds", MetricKind::e_Histogram);
+    for (const uint64_t value : {0, 1, 2, 3, 4, 7, 8})
+    {
+        Record(id, value);
+    }
+
+    const auto metric = FindMetric("bucket_bounds");
+    EXPECT_EQ(metric.count_, 7U);
+    EXPECT_EQ(metric.min_, 0U);
+    EXPECT_EQ(metric.max_, 8U);
+
+    // each bound is the largest value in its bucket, so exactly 2^i lands in the next one.
+
+    const auto text = SnapshotToPrometheus({metric}, "test_");
+    for (const std::string_view line : {"test_bucket_bounds_bucket{le=\"0\"} 1\n",
+                                        "test_bucket_bounds_bucket{le=\"1\"} 2\n",
+                                        "test_bucket_bounds_bucket{le=\"3\"} 4\n",
+                                        "test_bucket_bounds_bucket{le=\"7\"} 6\n",
+                                        "test_bucket_bounds_bucket{le=\"15\"} 7\n",
+                                        "test_bucket_bounds_bucket{le=\"+Inf\"} 7\n"})
+    {
+        EXPECT_NE(text.find(line), std::string::npos) << "missing: " << line << "in:\n" << text;
+    }
+
+    const auto json = SnapshotToJSON({metric});
+    ASSERT_EQ(json[0]["buckets"].size(), 5U);
+    EXPECT_EQ(json[0]["buckets"][3]["le"].asUInt64(), 7U);
+    EXPECT_EQ(json[0]["buckets"][3]["count"].asUInt64(), 2U);
+}
+
+TEST(Instrumentation, CountersHaveNoBuckets)
+{
+    const auto id = RegisterMetric("counter_buckets", MetricKind::e_Counter);
+    Record(id, 5);
+    Record(id, 6);
+
+    const auto metric = FindMetric("counter_buckets");
+    EXPECT_EQ(metric.count_, 2U);
+    EXPECT_EQ(metric.total_, 11U);
+    EXPECT_TRUE(std::ranges::all_of(metric.buckets_, [](uint64_t n) { return n == 0; }));
+    EXPECT_NE(SnapshotToPrometheus({metric}, "test_").find("test_counter_buckets_total 11\n"), std::string::npos);
+}
+
+TEST(Instrumentation, KeepsWhatExitedThreadsRecorded)
+{
+    const auto id = RegisterMetric("exited_threads", MetricKind::e_Timer, "rows");
+    {
+        std::vector<std::jthread> threads;
+        for (int32_t t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([id] {
+                for (uint64_t i = 0; i < 1'000; ++i)
+                {
+                    Record(id, i, 2);
+                }
+            });
+        }
+    }
+    const auto metric = FindMetric("exited_threads");
+    EXPECT_EQ(metric.count_, 4'000U);
+    EXPECT_EQ(metric.work_, 8'000U);
+    EXPECT_EQ(metric.max_, 999U);
+}
+
+TEST(Instrumentation, TooManyMetricsThrows)
+{
+    // other tests have registered some already. Keep going until we hit the limit.
+
+    int32_t registered = 0;
+    EXPECT_THROW(
+        {
+            for (; registered <= 256; ++registered)
+            {
+                static_cast<void>(RegisterMetric(std::format("limit_{}", registered), MetricKind::e_Counter));
+            }
+        },
+        std::runtime_error);
+    EXPECT_LE(registered, 256);
+
+    // existing names still work and can be recorded.
+
+    const auto id = RegisterMetric("limit_0", MetricKind::e_Counter);
+    Record(id, 3);
+    EXPECT_EQ(FindMetric("limit_0").total_, 3U);
+}
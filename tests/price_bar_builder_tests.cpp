@@ -0,0 +1,318 @@
+/* =====================================================================================
+ *
+ * Filename:  price_bar_builder_tests.cpp
+ *
+ * Description:  PriceBarBuilder's bars against a naive rescan of the ticks, across
+ *               day changes and both DST changes, plus the New York open alignment,
+ *               late ticks and Flush checked against hand worked UTC times.
+ *
+ * Version:  1.0
+ * Created:  2026-10-18 21:05:33
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <map>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "price_bar_builder.h"
+
+namespace
+{
+using namespace std::chrono_literals;
+
+// 7 minutes doesn't divide the time from midnight to 9:30 so it is the width which
+// shows bars are aligned to the open and not to the hour.
+
+constexpr auto bar_widths = std::to_array<std::chrono::seconds>({1min, 5min, 15min, 7min});
+
+struct Tick
+{
+    int64_t timestamp_seconds_;
+    double price_;
+};
+
+int64_t ToUnixSeconds(std::chrono::sys_seconds a_time)
+{
+    return a_time.time_since_epoch().count();
+}
+
+int64_t MakeUTC(std::chrono::year_month_day day, std::chrono::seconds time_of_day)
+{
+    return ToUnixSeconds(std::chrono::sys_days{day} + time_of_day);
+}
+
+// ticks mostly a minute or so apart with gaps and, now and then, a late one from up
+// to 20 minutes back.
+
+std::vector<Tick> MakeTicks(int64_t first, int64_t last, uint32_t seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<int64_t> step{1, 150};
+    std::uniform_int_distribution<int64_t> how_late{1, 1'200};
+    std::uniform_int_distribution<int32_t> is_late{0, 19};
+    std::uniform_int_distribution<int64_t> price_step{-25, 25};
+
+    std::vector<Tick> result;
+    int64_t cents = 10'000;
+    for (int64_t now = first; now < last; now += step(generator))
+    {
+        cents = std::max(int64_t{1}, cents + price_step(generator));
+        const auto timestamp = is_late(generator) == 0 ? now - how_late(generator) : now;
+        result.push_back({timestamp, static_cast<double>(cents) / 100.0});
+    }
+    return result;
+}
+
+// the bar a tick belongs in found by stepping, a bar at a time, from the 9:30 open of
+// the tick's day in New York.
+
+int64_t NaiveBarStart(int64_t timestamp_seconds, int64_t width)
+{
+    const auto *us_zone = GetUS_MarketTimeZone();
+    const auto local = us_zone->to_local(std::chrono::sys_seconds{std::chrono::seconds{timestamp_seconds}});
+    int64_t start = ToUnixSeconds(us_zone->to_sys(std::chrono::floor<std::chrono::days>(local) + 9h + 30min));
+    while (start > timestamp_seconds)
+    {
+        start -= width;
+    }
+    while (start + width <= timestamp_seconds)
+    {
+        start += width;
+    }
+    return start;
+}
+
+// rescan all the ticks for one width.  A tick which belongs in an earlier bar than
+// the last one goes in the last one.
+
+std::vector<PriceBar> NaiveBars(std::span<const Tick> ticks, int64_t width)
+{
+    std::vector<PriceBar> result;
+    for (const auto &[timestamp, price] : ticks)
+    {
+        const auto start = NaiveBarStart(timestamp, width);
+        if (result.empty() || start > result.back().start_seconds_)
+        {
+            result.push_back({start, width, price, price, price, price, 1});
+            continue;
+        }
+        auto &bar = result.back();
+        bar.high_ = std::max(bar.high_, price);
+        bar.low_ = std::min(bar.low_, price);
+        bar.close_ = price;
+        ++bar.tick_count_;
+    }
+    return result;
+}
+
+// the prices are passed through untouched so everything must match exactly.
+
+void ExpectSameBars(std::span<const PriceBar> expected, std::span<const PriceBar> actual, std::string_view what)
+{
+    ASSERT_EQ(actual.size(), expected.size()) << what;
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(actual[i].start_seconds_, expected[i].start_seconds_) << what << " bar: " << i;
+        ASSERT_EQ(actual[i].width_seconds_, expected[i].width_seconds_) << what << " bar: " << i;
+        ASSERT_EQ(actual[i].open_, expected[i].open_) << what << " bar: " << i;
+        ASSERT_EQ(actual[i].high_, expected[i].high_) << what << " bar: " << i;
+        ASSERT_EQ(actual[i].low_, expected[i].low_) << what << " bar: " << i;
+        ASSERT_EQ(actual[i].close_, expected[i].close_) << what << " bar: " << i;
+        ASSERT_EQ(actual[i].tick_count_, expected[i].tick_count_) << what << " bar: " << i;
+    }
+}
+
+// completed bars by symbol and width, in the order the builder passed them on.
+
+using CompletedBars = std::map<std::pair<SymbolID, int64_t>, std::vector<PriceBar>>;
+
+std::vector<PriceBar> &BarsFor(CompletedBars &completed, SymbolID id, std::chrono::seconds width)
+{
+    return completed[{id, width.count()}];
+}
+
+PriceBarBuilder MakeBuilder(CompletedBars &completed)
+{
+    return PriceBarBuilder{bar_widths,
+                           [&completed](SymbolID id, const PriceBar &bar) {
+                               completed[{id, bar.width_seconds_}].push_back(bar);
+                           }};
+}
+
+// symbol 0 gets the ticks one at a time and symbol 2 all at once (between flushes).
+// Symbol 0 is flushed every 'flush_every' ticks and both are flushed at the end.
+
+void ExpectMatchesNaiveRescan(std::span<const Tick> ticks, size_t flush_every)
+{
+    CompletedBars completed;
+    auto builder = MakeBuilder(completed);
+
+    std::vector<int64_t> timestamps;
+    std::vector<double> prices;
+    for (size_t i = 0; i < ticks.size(); ++i)
+    {
+        builder.AddTick(0, ticks[i].timestamp_seconds_, ticks[i].price_);
+        if ((i + 1) % flush_every == 0)
+        {
+            builder.Flush(0);
+        }
+        timestamps.push_back(ticks[i].timestamp_seconds_);
+        prices.push_back(ticks[i].price_);
+    }
+    builder.AddTicks(2, timestamps, prices);
+    builder.FlushAll();
+
+    for (const auto width : bar_widths)
+    {
+        std::vector<PriceBar> expected;
+        for (size_t first = 0; first < ticks.size(); first += flush_every)
+        {
+            const auto segment = NaiveBars(ticks.subspan(first, std::min(flush_every, ticks.size() - first)),
+                                           width.count());
+            expected.insert(expected.end(), segment.begin(), segment.end());
+        }
+        ExpectSameBars(expected, BarsFor(completed, 0, width), std::format("symbol: 0 width: {}", width));
+        ExpectSameBars(NaiveBars(ticks, width.count()), BarsFor(completed, 2, width),
+                       std::format("symbol: 2 width: {}", width));
+        EXPECT_TRUE(BarsFor(completed, 1, width).empty());
+    }
+}
+
+void ExpectCurrentStarts(const PriceBarBuilder &builder, SymbolID id, const std::array<int64_t, 4> &starts)
+{
+    for (size_t i = 0; i < starts.size(); ++i)
+    {
+        const auto *bar = builder.GetCurrentBar(id, i);
+        ASSERT_NE(bar, nullptr) << "width: " << bar_widths[i];
+        EXPECT_EQ(bar->start_seconds_, starts[i]) << "width: " << bar_widths[i];
+    }
+}
+} // namespace
+
+// Friday before the spring change, the short Sunday and Monday on daylight time, with
+// ticks through the evenings and nights so they run into each new day.
+
+TEST(PriceBarBuilder, MatchesNaiveRescanAcrossSpringDST)
+{
+    const auto ticks = MakeTicks(MakeUTC(std::chrono::year{2024} / 3 / 8, 9h),
+                                 MakeUTC(std::chrono::year{2024} / 3 / 11, 22h), 20261018);
+    ExpectMatchesNaiveRescan(ticks, ticks.size());
+}
+
+TEST(PriceBarBuilder, MatchesNaiveRescanAcrossFallDSTWithFlushes)
+{
+    const auto ticks = MakeTicks(MakeUTC(std::chrono::year{2024} / 11 / 1, 9h),
+                                 MakeUTC(std::chrono::year{2024} / 11 / 4, 22h), 20261019);
+    ExpectMatchesNaiveRescan(ticks, 997);
+}
+
+TEST(PriceBarBuilder, AlignsToNewYorkOpen)
+{
+    CompletedBars completed;
+    auto builder = MakeBuilder(completed);
+
+    // on standard time the open is 14:30 UTC.  A tick before the open rounds down.
+
+    constexpr std::chrono::year_month_day winter_day{std::chrono::year{2024} / 1 / 5};
+    builder.AddTick(0, MakeUTC(winter_day, 14h + 27min + 10s), 100.0);
+    ExpectCurrentStarts(builder, 0,
+                        {MakeUTC(winter_day, 14h + 27min), MakeUTC(winter_day, 14h + 25min),
+                         MakeUTC(winter_day, 14h + 15min), MakeUTC(winter_day, 14h + 23min)});
+
+    builder.AddTick(0, MakeUTC(winter_day, 14h + 44min + 59s), 101.0);
+    ExpectCurrentStarts(builder, 0,
+                        {MakeUTC(winter_day, 14h + 44min), MakeUTC(winter_day, 14h + 40min),
+                         MakeUTC(winter_day, 14h + 30min), MakeUTC(winter_day, 14h + 44min)});
+    for (const auto width : bar_widths)
+    {
+        EXPECT_EQ(BarsFor(completed, 0, width).size(), 1U) << "width: " << width;
+    }
+
+    // the last bar on the Friday before the spring change and the first on the Monday,
+    // when the open is 13:30 UTC.
+
+    constexpr std::chrono::year_month_day friday{std::chrono::year{2024} / 3 / 8};
+    constexpr std::chrono::year_month_day monday{std::chrono::year{2024} / 3 / 11};
+    builder.AddTick(1, MakeUTC(friday, 20h + 59min), 50.0);
+    builder.AddTick(1, MakeUTC(monday, 13h + 30min), 51.0);
+    ExpectCurrentStarts(builder, 1,
+                        {MakeUTC(monday, 13h + 30min), MakeUTC(monday, 13h + 30min), MakeUTC(monday, 13h + 30min),
+                         MakeUTC(monday, 13h + 30min)});
+    const auto &fridays_bar = BarsFor(completed, 1, 15min);
+    ASSERT_EQ(fridays_bar.size(), 1U);
+    EXPECT_EQ(fridays_bar[0].start_seconds_, MakeUTC(friday, 20h + 45min));
+
+    // after the fall change, back to 14:30 UTC.
+
+    constexpr std::chrono::year_month_day fall_monday{std::chrono::year{2024} / 11 / 4};
+    builder.AddTick(1, MakeUTC(fall_monday, 14h + 29min + 59s), 52.0);
+    ExpectCurrentStarts(builder, 1,
+                        {MakeUTC(fall_monday, 14h + 29min), MakeUTC(fall_monday, 14h + 25min),
+                         MakeUTC(fall_monday, 14h + 15min), MakeUTC(fall_monday, 14h + 23min)});
+}
+
+TEST(PriceBarBuilder, LateTicksAndFlush)
+{
+    CompletedBars completed;
+    auto builder = MakeBuilder(completed);
+
+    const auto open = MakeUTC(std::chrono::year{2024} / 1 / 5, 14h + 30min);
+    builder.AddTick(0, open + 10, 100.0);
+    builder.AddTick(0, open + 70, 101.0);
+    ASSERT_EQ(BarsFor(completed, 0, 1min).size(), 1U);
+
+    // a late tick is folded into the bar in progress and completes nothing.
+
+    builder.AddTick(0, open + 5, 99.0);
+    EXPECT_EQ(BarsFor(completed, 0, 1min).size(), 1U);
+    const auto *minute_bar = builder.GetCurrentBar(0, 0);
+    ASSERT_NE(minute_bar, nullptr);
+    EXPECT_EQ(minute_bar->start_seconds_, open + 60);
+    EXPECT_EQ(minute_bar->open_, 101.0);
+    EXPECT_EQ(minute_bar->low_, 99.0);
+    EXPECT_EQ(minute_bar->close_, 99.0);
+    EXPECT_EQ(minute_bar->tick_count_, 2U);
+
+    // Flush passes on the bars in progress for just that symbol.
+
+    builder.AddTick(3, open, 10.0);
+    builder.Flush(0);
+    builder.Flush(7);
+    for (size_t i = 0; i < bar_widths.size(); ++i)
+    {
+        EXPECT_EQ(builder.GetCurrentBar(0, i), nullptr) << "width: " << bar_widths[i];
+        EXPECT_NE(builder.GetCurrentBar(3, i), nullptr) << "width: " << bar_widths[i];
+    }
+    const auto &five_minute_bars = BarsFor(completed, 0, 5min);
+    ASSERT_EQ(five_minute_bars.size(), 1U);
+    EXPECT_EQ(five_minute_bars[0].start_seconds_, open);
+    EXPECT_EQ(five_minute_bars[0].tick_count_, 3U);
+    EXPECT_EQ(BarsFor(completed, 0, 1min).back().tick_count_, 2U);
+    EXPECT_TRUE(BarsFor(completed, 3, 1min).empty());
+
+    // after a flush an early tick starts its own bar.
+
+    builder.AddTick(0, open + 5, 98.0);
+    ExpectCurrentStarts(builder, 0, {open, open, open, open});
+    builder.FlushAll();
+    EXPECT_EQ(BarsFor(completed, 3, 1min).size(), 1U);
+    EXPECT_EQ(BarsFor(completed, 0, 1min).size(), 3U);
+}
@@ -0,0 +1,254 @@
+/* =====================================================================================
+ *
+ * Filename:  price_snapshot_tests.cpp
+ *
+ * Description:  Write each kind of price snapshot, read it back and compare.  Also
+ *               check that files missing a column or with a short column, and reading
+ *               a snapshot as the wrong kind, are refused.
+ *
+ * Version:  1.0
+ * Created:  2026-10-18 14:22:05
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "price_snapshot.h"
+
+namespace
+{
+using namespace std::chrono_literals;
+
+// a file in the system temporary directory, removed when done.
+
+class TemporaryFile
+{
+public:
+    explicit TemporaryFile(const std::string &name)
+        : file_name_{fs::temp_directory_path() / std::format("price_snapshot_tests_{}_{}", getpid(), name)}
+    {
+    }
+    TemporaryFile(const TemporaryFile &rhs) = delete;
+    ~TemporaryFile()
+    {
+        std::error_code ec;
+        fs::remove(file_name_, ec);
+    }
+
+    [[nodiscard]] const fs::path &GetPath() const
+    {
+        return file_name_;
+    }
+
+    TemporaryFile &operator=(const TemporaryFile &rhs) = delete;
+
+private:
+    fs::path file_name_;
+};
+
+std::chrono::utc_clock::time_point MakeTimePoint(std::chrono::sys_days day)
+{
+    return std::chrono::utc_clock::from_sys(day + 16h);
+}
+
+std::vector<DateCloseRecord> MakeDateCloseRecords()
+{
+    constexpr std::chrono::sys_days first_day{std::chrono::year{2024} / 3 / 4};
+    return {{MakeTimePoint(first_day), Decimal{"171.13"}},
+            {MakeTimePoint(first_day + std::chrono::days{1}), Decimal{"169.12"}},
+            {MakeTimePoint(first_day + std::chrono::days{2}), Decimal{"170.73"}}};
+}
+
+// change the directory entry for 'which' in an existing snapshot file.
+
+void PatchColumnEntry(const fs::path &file_name, PriceSnapshotColumn which,
+                      const std::function<void(PriceSnapshotColumnEntry &)> &patch)
+{
+    std::fstream snapshot{file_name, std::ios::in | std::ios::out | std::ios::binary};
+    PriceSnapshotHeader header{};
+    snapshot.read(reinterpret_cast<char *>(&header), sizeof(header));
+    for (uint32_t i = 0; i < header.column_count_; ++i)
+    {
+        const auto where = static_cast<std::streamoff>(sizeof(header) + i * sizeof(PriceSnapshotColumnEntry));
+        PriceSnapshotColumnEntry entry{};
+        snapshot.seekg(where);
+        snapshot.read(reinterpret_cast<char *>(&entry), sizeof(entry));
+        if (entry.column_ == which)
+        {
+            patch(entry);
+            snapshot.seekp(where);
+            snapshot.write(reinterpret_cast<const char *>(&entry), sizeof(entry));
+            return;
+        }
+    }
+    throw std::runtime_error(std::format("No column: {} to patch.", std::to_underlying(which)));
+}
+} // namespace
+
+TEST(PriceSnapshot, PriceHistoryColumnsRoundTrip)
+{
+    PriceHistoryColumns history{"AAPL"};
+    history.AddRow(std::chrono::year{2024} / 3 / 4, Decimal{"176.15"}, Decimal{"176.90"}, Decimal{"173.79"},
+                   Decimal{"175.10"});
+    history.AddRow(std::chrono::year{2024} / 3 / 5, Decimal{"170.76"}, Decimal{"172.04"}, Decimal{"169.62"},
+                   Decimal{"170.12"});
+
+    TemporaryFile snapshot{"columns"};
+    WritePriceSnapshot(snapshot.GetPath(), history);
+
+    const PriceSnapshotReader reader{snapshot.GetPath()};
+    EXPECT_EQ(reader.GetKind(), PriceSnapshotKind::e_StockData);
+    ASSERT_EQ(reader.size(), history.size());
+    EXPECT_EQ(reader.GetSymbol(0), "AAPL");
+
+    const auto loaded = reader.ToPriceHistoryColumns();
+    EXPECT_EQ(loaded.GetSymbol(), history.GetSymbol());
+    EXPECT_TRUE(std::ranges::equal(loaded.GetDates(), history.GetDates()));
+    EXPECT_TRUE(std::ranges::equal(loaded.GetOpens(), history.GetOpens()));
+    EXPECT_TRUE(std::ranges::equal(loaded.GetHighs(), history.GetHighs()));
+    EXPECT_TRUE(std::ranges::equal(loaded.GetLows(), history.GetLows()));
+    EXPECT_TRUE(std::ranges::equal(loaded.GetCloses(), history.GetCloses()));
+}
+
+TEST(PriceSnapshot, StockDataRecordsRoundTripKeepsOnlyTheDate)
+{
+    const std::vector<StockDataRecord> history{
+        {"2024-03-04T00:00:00.000Z", "MSFT", Decimal{"413.44"}, Decimal{"415.38"}, Decimal{"410.11"},
+         Decimal{"414.92"}},
+        {"2024-03-05", "MSFT", Decimal{"413.96"}, Decimal{"414.25"}, Decimal{"398.49"}, Decimal{"402.65"}}};
+
+    TemporaryFile snapshot{"records"};
+    WritePriceSnapshot(snapshot.GetPath(), history);
+
+    const auto loaded = PriceSnapshotReader{snapshot.GetPath()}.ToStockDataRecords();
+    ASSERT_EQ(loaded.size(), history.size());
+    EXPECT_EQ(loaded[0].date_, "2024-03-04");
+    EXPECT_EQ(loaded[1].date_, "2024-03-05");
+    for (size_t i = 0; i < history.size(); ++i)
+    {
+        EXPECT_EQ(loaded[i].symbol_, history[i].symbol_);
+        EXPECT_EQ(loaded[i].open_, history[i].open_);
+        EXPECT_EQ(loaded[i].high_, history[i].high_);
+        EXPECT_EQ(loaded[i].low_, history[i].low_);
+        EXPECT_EQ(loaded[i].close_, history[i].close_);
+    }
+}
+
+TEST(PriceSnapshot, DateCloseRecordsRoundTrip)
+{
+    const auto history = MakeDateCloseRecords();
+
+    TemporaryFile snapshot{"date_close"};
+    WritePriceSnapshot(snapshot.GetPath(), "IBM", history);
+
+    const PriceSnapshotReader reader{snapshot.GetPath()};
+    EXPECT_EQ(reader.GetKind(), PriceSnapshotKind::e_DateClose);
+    EXPECT_EQ(reader.GetSymbol(0), "IBM");
+    EXPECT_TRUE(reader.GetOpens().empty());
+
+    const auto loaded = reader.ToDateCloseRecords();
+    ASSERT_EQ(loaded.size(), history.size());
+    for (size_t i = 0; i < history.size(); ++i)
+    {
+        EXPECT_EQ(loaded[i].date_, history[i].date_);
+        EXPECT_EQ(loaded[i].close_, history[i].close_);
+    }
+}
+
+TEST(PriceSnapshot, MultiSymbolDateCloseRecordsRoundTrip)
+{
+    const auto day = MakeTimePoint(std::chrono::year{2024} / 3 / 4);
+    const std::vector<MultiSymbolDateCloseRecord> history{{"AAPL", day, Decimal{"175.10"}},
+                                                          {"MSFT", day, Decimal{"414.92"}},
+                                                          {"AAPL", day + std::chrono::days{1}, Decimal{"170.12"}},
+                                                          {"IBM", day + std::chrono::days{1}, Decimal{"196.16"}}};
+
+    TemporaryFile snapshot{"multi_symbol"};
+    WritePriceSnapshot(snapshot.GetPath(), history);
+
+    const PriceSnapshotReader reader{snapshot.GetPath()};
+    EXPECT_EQ(reader.GetKind(), PriceSnapshotKind::e_MultiSymbolDateClose);
+    EXPECT_EQ(reader.GetSymbolCount(), 3U);
+
+    const auto loaded = reader.ToMultiSymbolDateCloseRecords();
+    ASSERT_EQ(loaded.size(), history.size());
+    for (size_t i = 0; i < history.size(); ++i)
+    {
+        EXPECT_EQ(loaded[i].symbol_, history[i].symbol_);
+        EXPECT_EQ(loaded[i].date_, history[i].date_);
+        EXPECT_EQ(loaded[i].close_, history[i].close_);
+    }
+}
+
+TEST(PriceSnapshot, EmptyHistoryRoundTrip)
+{
+    TemporaryFile snapshot{"empty"};
+    WritePriceSnapshot(snapshot.GetPath(), "IBM", std::vector<DateCloseRecord>{});
+
+    const PriceSnapshotReader reader{snapshot.GetPath()};
+    EXPECT_TRUE(reader.empty());
+    EXPECT_TRUE(reader.ToDateCloseRecords().empty());
+}
+
+TEST(PriceSnapshot, RefusesReadingAsTheWrongKind)
+{
+    TemporaryFile snapshot{"wrong_kind"};
+    WritePriceSnapshot(snapshot.GetPath(), "IBM", MakeDateCloseRecords());
+
+    const PriceSnapshotReader reader{snapshot.GetPath()};
+    EXPECT_THROW(static_cast<void>(reader.ToPriceHistoryColumns()), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(reader.ToStockDataRecords()), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(reader.ToMultiSymbolDateCloseRecords()), std::runtime_error);
+    EXPECT_EQ(reader.ToDateCloseRecords().size(), reader.size());
+}
+
+TEST(PriceSnapshot, RefusesMissingRequiredColumn)
+{
+    TemporaryFile snapshot{"missing_column"};
+    WritePriceSnapshot(snapshot.GetPath(), "IBM", MakeDateCloseRecords());
+
+    // relabel the closes as opens: a date/close file with no closes and a column it
+    // shouldn't have.
+
+    PatchColumnEntry(snapshot.GetPath(), PriceSnapshotColumn::e_Close,
+                     [](PriceSnapshotColumnEntry &entry) { entry.column_ = PriceSnapshotColumn::e_Open; });
+    EXPECT_THROW(PriceSnapshotReader{snapshot.GetPath()}, std::runtime_error);
+}
+
+TEST(PriceSnapshot, RefusesShortColumn)
+{
+    TemporaryFile snapshot{"short_column"};
+    WritePriceSnapshot(snapshot.GetPath(), "IBM", MakeDateCloseRecords());
+
+    PatchColumnEntry(snapshot.GetPath(), PriceSnapshotColumn::e_Close,
+                     [](PriceSnapshotColumnEntry &entry) { --entry.element_count_; });
+    EXPECT_THROW(PriceSnapshotReader{snapshot.GetPath()}, std::runtime_error);
+}
+
+TEST(PriceSnapshot, RefusesTruncatedFile)
+{
+    TemporaryFile snapshot{"truncated"};
+    WritePriceSnapshot(snapshot.GetPath(), "IBM", MakeDateCloseRecords());
+
+    fs::resize_file(snapshot.GetPath(), fs::file_size(snapshot.GetPath()) - sizeof(Decimal));
+    EXPECT_THROW(PriceSnapshotReader{snapshot.GetPath()}, std::runtime_error);
+}
@@ -0,0 +1,240 @@
+/* =====================================================================================
+ *
+ * Filename:  rolling_window_tests.cpp
+ *
+ * Description:  The rolling window kernels against naive versions which compute
+ *               every window from scratch, for both the double and the int64_t
+ *               overloads, and the batch version against one series at a time.
+ *
+ * Version:  1.0
+ * Created:  2026-10-18 15:07:26
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rolling_window.h"
+
+namespace
+{
+// long enough that the periodic recompute of the rolling sums happens many times.
+
+constexpr size_t how_many_prices = 5'000;
+constexpr auto windows = std::to_array<size_t>({1, 2, 3, 20, 200, how_many_prices});
+
+// a random walk of prices with 2 decimal places, as our data has.
+
+std::vector<double> MakeCloses(size_t how_many, uint32_t seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<int64_t> step{-150, 150};
+    std::vector<double> result;
+    result.reserve(how_many);
+    int64_t cents = 10'000;
+    for (size_t i = 0; i < how_many; ++i)
+    {
+        cents = std::max(int64_t{1}, cents + step(generator));
+        result.push_back(static_cast<double>(cents) / 100.0);
+    }
+    return result;
+}
+
+// the raw values of FixedPrice<4> columns, including negative ones.
+
+std::vector<int64_t> MakeRawValues(size_t how_many, uint32_t seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<int64_t> value{-5'000'000'000, 5'000'000'000};
+    std::vector<int64_t> result(how_many);
+    std::ranges::generate(result, [&] { return value(generator); });
+    return result;
+}
+
+// --- the naive versions: every window computed from scratch ---
+
+template <typename T, typename Func> std::vector<T> NaiveRolling(std::span<const T> values, size_t window, Func func)
+{
+    std::vector<T> result;
+    for (size_t i = 0; i + window <= values.size(); ++i)
+    {
+        result.push_back(func(values.subspan(i, window)));
+    }
+    return result;
+}
+
+template <typename T> T Sum(std::span<const T> window)
+{
+    return std::accumulate(window.begin(), window.end(), T{0});
+}
+
+template <typename T> T Min(std::span<const T> window)
+{
+    return std::ranges::min(window);
+}
+
+template <typename T> T Max(std::span<const T> window)
+{
+    return std::ranges::max(window);
+}
+
+double Mean(std::span<const double> window)
+{
+    return Sum(window) / static_cast<double>(window.size());
+}
+
+double Variance(std::span<const double> window)
+{
+    if (window.size() < 2)
+    {
+        return 0.0;
+    }
+    const double mean = Mean(window);
+    double squares = 0.0;
+    for (const auto value : window)
+    {
+        squares += (value - mean) * (value - mean);
+    }
+    return squares / static_cast<double>(window.size() - 1);
+}
+
+double StdDev(std::span<const double> window)
+{
+    return std::sqrt(Variance(window));
+}
+
+// relative difference, allowing for the different order of the floating point operations.
+// Variances of nearly flat windows can be tiny so they get an absolute floor.
+
+void ExpectNear(std::span<const double> expected, std::span<const double> actual, size_t window)
+{
+    ASSERT_EQ(expected.size(), actual.size()) << "window: " << window;
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_NEAR(expected[i], actual[i], 1e-9 * std::max(1.0, std::abs(expected[i])))
+            << "window: " << window << " index: " << i;
+    }
+}
+} // namespace
+
+TEST(RollingWindow, DoubleKernelsMatchNaive)
+{
+    const auto closes = MakeCloses(how_many_prices, 20261018);
+    const std::span<const double> values{closes};
+    for (const auto window : windows)
+    {
+        ExpectNear(NaiveRolling(values, window, Sum<double>), RollingSum(values, window), window);
+        ExpectNear(NaiveRolling(values, window, Mean), RollingMean(values, window), window);
+        ExpectNear(NaiveRolling(values, window, Variance), RollingVariance(values, window), window);
+        ExpectNear(NaiveRolling(values, window, StdDev), RollingStdDev(values, window), window);
+
+        // min and max pick out one of the values so they must be exact.
+
+        EXPECT_EQ(RollingMin(values, window), NaiveRolling(values, window, Min<double>)) << "window: " << window;
+        EXPECT_EQ(RollingMax(values, window), NaiveRolling(values, window, Max<double>)) << "window: " << window;
+    }
+}
+
+TEST(RollingWindow, MinMaxWithRunsAndTies)
+{
+    // monotonic runs and repeated values are where a monotonic deque goes wrong.
+
+    std::vector<double> values;
+    for (int32_t i = 0; i < 50; ++i)
+    {
+        values.push_back(static_cast<double>(i));
+    }
+    for (int32_t i = 50; i > 0; --i)
+    {
+        values.push_back(static_cast<double>(i));
+    }
+    values.insert(values.end(), 30, 7.0);
+    for (const size_t window : {1, 2, 5, 31, 60})
+    {
+        EXPECT_EQ(RollingMin(values, window), NaiveRolling<double>(values, window, Min<double>))
+            << "window: " << window;
+        EXPECT_EQ(RollingMax(values, window), NaiveRolling<double>(values, window, Max<double>))
+            << "window: " << window;
+    }
+}
+
+TEST(RollingWindow, Int64KernelsMatchNaiveExactly)
+{
+    const auto raw_values = MakeRawValues(how_many_prices, 20261019);
+    const std::span<const int64_t> values{raw_values};
+    for (const auto window : windows)
+    {
+        EXPECT_EQ(RollingSum(values, window), NaiveRolling(values, window, Sum<int64_t>)) << "window: " << window;
+        EXPECT_EQ(RollingMin(values, window), NaiveRolling(values, window, Min<int64_t>)) << "window: " << window;
+        EXPECT_EQ(RollingMax(values, window), NaiveRolling(values, window, Max<int64_t>)) << "window: " << window;
+    }
+}
+
+TEST(RollingWindow, WindowLongerThanSeries)
+{
+    const std::vector<double> values{1.0, 2.0, 3.0};
+    const std::vector<int64_t> raw_values{1, 2, 3};
+    EXPECT_TRUE(RollingSum(values, 4).empty());
+    EXPECT_TRUE(RollingVariance(values, 4).empty());
+    EXPECT_TRUE(RollingMax(raw_values, 4).empty());
+    EXPECT_EQ(RollingSum(values, 3), std::vector<double>{6.0});
+}
+
+TEST(RollingWindow, Returns)
+{
+    const auto closes = MakeCloses(1'001, 20261020);
+    std::vector<double> simple;
+    std::vector<double> log;
+    for (size_t i = 1; i < closes.size(); ++i)
+    {
+        simple.push_back(closes[i] / closes[i - 1] - 1.0);
+        log.push_back(std::log(closes[i] / closes[i - 1]));
+    }
+    ExpectNear(simple, SimpleReturns(closes), 1);
+    ExpectNear(log, LogReturns(closes), 1);
+    EXPECT_TRUE(SimpleReturns(std::vector<double>{1.0}).empty());
+}
+
+TEST(RollingWindow, ComputeRollingBatchMatchesSerial)
+{
+    // uneven lengths, including series shorter than the window, so some threads get
+    // much more work than others.
+
+    std::vector<std::vector<double>> series;
+    for (uint32_t s = 0; s < 37; ++s)
+    {
+        series.push_back(MakeCloses(10 + s * 97, 20261021 + s));
+    }
+
+    using enum RollingStatistic;
+    for (const auto statistic : {e_Sum, e_Mean, e_Min, e_Max, e_Variance, e_StdDev})
+    {
+        std::vector<std::vector<double>> expected;
+        for (const auto &values : series)
+        {
+            expected.push_back(ComputeRolling(statistic, values, 50));
+        }
+        for (const uint32_t thread_count : {0U, 1U, 2U, 3U, 8U, 64U})
+        {
+            EXPECT_EQ(ComputeRollingBatch(statistic, series, 50, thread_count), expected)
+                << "statistic: " << std::to_underlying(statistic) << " threads: " << thread_count;
+        }
+    }
+    EXPECT_TRUE(ComputeRollingBatch(e_Mean, std::span<const std::vector<double>>{}, 50, 4).empty());
+}
@@ -0,0 +1,191 @@
+/* =====================================================================================
+ *
+ * Filename:  split_string_tests.cpp
+ *
+ * Description:  The vectorized character search and split_string against plain
+ *               scalar versions, including short tails and text which ends right
+ *               at the end of a readable page.
+ *
+ * Version:  1.0
+ * Created:  2026-10-18 09:12:37
+ * Revision:  none
+ * Compiler:  gcc / g++
+ *
+ * Author:  David P. Riedel <driedel@cox.net>
+ * Copyright (c) 2026, David P. Riedel
+ *
+ * =====================================================================================
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "utilities.h"
+
+namespace
+{
+// the split_string we started from. Same results, one item at a time.
+
+std::vector<std::string_view> ScalarSplit(std::string_view string_data, std::string_view delim)
+{
+    std::vector<std::string_view> results;
+    for (size_t it = 0; it < string_data.size(); ++it)
+    {
+        auto pos = string_data.find(delim, it);
+        if (pos != std::string_view::npos)
+        {
+            results.emplace_back(string_data.substr(it, pos - it));
+        }
+        else
+        {
+            results.emplace_back(string_data.substr(it));
+            break;
+        }
+        it = pos;
+    }
+    return results;
+}
+
+// random text from a small alphabet so delimiters show up often, and sometimes in runs.
+
+std::string MakeText(std::mt19937 &generator, size_t how_many)
+{
+    static constexpr std::string_view chars{",,:abcdefgh"};
+    std::uniform_int_distribution<size_t> which_char{0, chars.size() - 1};
+    std::string result(how_many, ' ');
+    std::ranges::generate(result, [&] { return chars[which_char(generator)]; });
+    return result;
+}
+
+// 2 pages with the second one inaccessible so reading even 1 byte past the first
+// page faults.
+
+class GuardedPage
+{
+public:
+    GuardedPage() : page_size_{static_cast<size_t>(sysconf(_SC_PAGESIZE))}
+    {
+        void *pages = mmap(nullptr, 2 * page_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pages == MAP_FAILED)
+        {
+            throw std::runtime_error("Can't map test pages.");
+        }
+        pages_ = static_cast<char *>(pages);
+        mprotect(pages_ + page_size_, page_size_, PROT_NONE);
+    }
+    GuardedPage(const GuardedPage &rhs) = delete;
+    ~GuardedPage()
+    {
+        munmap(pages_, 2 * page_size_);
+    }
+
+    // put 'text' so it ends exactly at the guard page.
+
+    std::string_view Place(std::string_view text)
+    {
+        char *first = pages_ + page_size_ - text.size();
+        std::ranges::copy(text, first);
+        return {first, text.size()};
+    }
+
+    GuardedPage &operator=(const GuardedPage &rhs) = delete;
+
+private:
+    size_t page_size_;
+    char *pages_ = nullptr;
+};
+} // namespace
+
+TEST(CharSearch, MatchesScalarForEveryLengthAndPosition)
+{
+    // 0 - 100 covers no full vector, full vectors and every tail length for SSE and AVX.
+
+    for (size_t length = 0; length <= 100; ++length)
+    {
+        for (size_t where = 0; where <= length; ++where)
+        {
+            std::string text(length, 'a');
+            if (where < length)
+            {
+                text[where] = ',';
+            }
+            const char *first = text.data();
+            const char *last = text.data() + text.size();
+            EXPECT_EQ(char_search::FindChar(first, last, ','), std::find(first, last, ','))
+                << "length: " << length << " position: " << where;
+            EXPECT_EQ(char_search::CountChar(first, last, ','), static_cast<size_t>(std::count(first, last, ',')))
+                << "length: " << length << " position: " << where;
+        }
+    }
+}
+
+TEST(CharSearch, DoesNotReadPastTheEnd)
+{
+    GuardedPage page;
+    std::mt19937 generator{20261018};
+    for (size_t length = 0; length <= 200; ++length)
+    {
+        const auto text = page.Place(MakeText(generator, length));
+        const char *first = text.data();
+        const char *last = text.data() + text.size();
+        EXPECT_EQ(char_search::FindChar(first, last, '!'), last);
+        EXPECT_EQ(char_search::CountChar(first, last, ','), static_cast<size_t>(std::count(first, last, ',')));
+    }
+}
+
+TEST(SplitString, MatchesScalarSplit)
+{
+    std::mt19937 generator{20261018};
+    for (size_t length = 0; length <= 300; ++length)
+    {
+        for (int32_t trial = 0; trial < 20; ++trial)
+        {
+            const auto text = MakeText(generator, length);
+            for (const std::string_view delim : {",", "::"})
+            {
+                const auto expected = ScalarSplit(text, delim);
+                EXPECT_EQ(split_string<std::string_view>(text, delim), expected) << "text: '" << text << "'";
+
+                const auto as_strings = split_string<std::string>(text, delim);
+                EXPECT_TRUE(std::ranges::equal(as_strings, expected)) << "text: '" << text << "'";
+
+                std::vector<std::string_view> from_iterator;
+                split_string<std::string_view>(text, delim, std::back_inserter(from_iterator));
+                EXPECT_EQ(from_iterator, expected) << "text: '" << text << "'";
+            }
+        }
+    }
+}
+
+TEST(SplitString, AtPageBoundary)
+{
+    GuardedPage page;
+    std::mt19937 generator{20261019};
+    for (size_t length = 0; length <= 200; ++length)
+    {
+        const auto text = page.Place(MakeText(generator, length));
+        EXPECT_EQ(split_string<std::string_view>(text, ","), ScalarSplit(text, ","));
+    }
+}
+
+TEST(SplitString, EdgeCases)
+{
+    using Items = std::vector<std::string_view>;
+    EXPECT_EQ(split_string<std::string_view>("", ","), Items{});
+    EXPECT_EQ(split_string<std::string_view>(",", ","), Items{""});
+    EXPECT_EQ(split_string<std::string_view>("a,", ","), Items{"a"});
+    EXPECT_EQ(split_string<std::string_view>(",a", ","), (Items{"", "a"}));
+    EXPECT_EQ(split_string<std::string_view>("a,,b", ","), (Items{"a", "", "b"}));
+    EXPECT_EQ(split_string<std::string_view>("abc", ","), Items{"abc"});
+}